@@ -0,0 +1,106 @@
+#include "BulkLoader.h"
+#include <algorithm>
+/*
+ * @file BulkLoader.cpp
+ * @author Katarina McGaughy
+ * BulkLoader splits the contents of an InputSource into records without
+ * copying them. The DelimiterScanner finds the newlines and commas of a
+ * whole block at once and each record is handed out as a FieldTokenizer
+ * that already knows where its fields end.
+ *
+ * Features:
+ * -scan the input in blocks
+ * -split blocks into records and fields
+ *
+ * Assumptions:
+ * -records are separated by '\n' and fields by ','
+ * -the InputSource outlives the BulkLoader and the records it returns
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * @brief Construct a new BulkLoader object
+  * @param source : input to split into records
+  * @param size : number of bytes scanned at a time
+  */
+BulkLoader::BulkLoader(const InputSource& source, size_t size) :
+    input(source.getData()), blockSize(size) {}
+
+/**
+ * @brief Construct a new BulkLoader object
+ * @param text : input to split into records
+ * @param size : number of bytes scanned at a time
+ */
+BulkLoader::BulkLoader(string_view text, size_t size) :
+    input(text), blockSize(size) {}
+
+/**
+ * scanBlock
+ * this function starts the next block at the unfinished record
+ * and scans it
+ * Preconditions: none
+ * Postconditions: returns false if the input has no more bytes
+ */
+bool BulkLoader::scanBlock() {
+    size_t start = blockStart + lineStart;
+    size_t oldEnd = blockStart + blockLen;
+    if (oldEnd >= input.size()) {
+        return false;
+    }
+    //a record longer than the block needs a bigger block
+    if (start == blockStart && blockLen == blockSize) {
+        blockSize *= 2;
+    }
+    blockStart = start;
+    blockLen = min(blockSize, input.size() - blockStart);
+    lineStart = 0;
+    delims.clear();
+    nextDelim = 0;
+    DelimiterScanner::scan(input.data() + blockStart, blockLen, delims);
+    return true;
+}
+
+/**
+ * nextRecord
+ * this function sets fields to the next record of the input
+ * Preconditions: none
+ * Postconditions: returns false if there are no records left
+ * @param fields : set to a tokenizer over the next record
+ * @return true : if a record was found
+ */
+bool BulkLoader::nextRecord(FieldTokenizer& fields) {
+    const char* block = input.data() + blockStart;
+    while (true) {
+        //look for the newline that ends the next record
+        size_t end = nextDelim;
+        while (end < delims.size() && block[delims[end]] != '\n') {
+            end++;
+        }
+        if (end < delims.size()) {
+            string_view line(block + lineStart, delims[end] - lineStart);
+            fields = FieldTokenizer(line, delims.data() + nextDelim,
+                end - nextDelim, lineStart);
+            lineStart = delims[end] + 1;
+            nextDelim = end + 1;
+            return true;
+        }
+        if (!scanBlock()) {
+            //last record does not end with a newline
+            if (lineStart < blockLen) {
+                string_view line(block + lineStart, blockLen - lineStart);
+                fields = FieldTokenizer(line, delims.data() + nextDelim,
+                    delims.size() - nextDelim, lineStart);
+                lineStart = blockLen;
+                nextDelim = delims.size();
+                return true;
+            }
+            return false;
+        }
+        block = input.data() + blockStart;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+/*
+ * @file BulkLoader.h
+ * @author Katarina McGaughy
+ * BulkLoader splits the contents of an InputSource into records without
+ * copying them. The DelimiterScanner finds the newlines and commas of a
+ * whole block at once and each record is handed out as a FieldTokenizer
+ * that already knows where its fields end.
+ *
+ * Features:
+ * -scan the input in blocks
+ * -split blocks into records and fields
+ *
+ * Assumptions:
+ * -records are separated by '\n' and fields by ','
+ * -the InputSource outlives the BulkLoader and the records it returns
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <vector>
+#include "FieldTokenizer.h"
+#include "DelimiterScanner.h"
+#include "InputSource.h"
+using namespace std;
+
+class BulkLoader
+{
+private:
+    string_view input;          // whole input
+    size_t blockSize;           // bytes scanned at a time
+    size_t blockStart = 0;      // offset of the current block in input
+    size_t blockLen = 0;        // bytes in the current block
+    size_t lineStart = 0;       // offset of the next record in the block
+    vector<uint32_t> delims;    // offsets of the delimiters in the block
+    size_t nextDelim = 0;       // first delimiter of the next record
+
+    /**
+     * scanBlock
+     * this function starts the next block at the unfinished record
+     * and scans it
+     * Preconditions: none
+     * Postconditions: returns false if the input has no more bytes
+     */
+    bool scanBlock();
+
+public:
+
+    /**
+     * @brief Construct a new BulkLoader object
+     * @param source : input to split into records
+     * @param size : number of bytes scanned at a time
+     */
+    BulkLoader(const InputSource& source, size_t size = 1 << 20);
+
+    /**
+     * @brief Construct a new BulkLoader object
+     * @param text : input to split into records
+     * @param size : number of bytes scanned at a time
+     */
+    BulkLoader(string_view text, size_t size = 1 << 20);
+
+    /**
+     * nextRecord
+     * this function sets fields to the next record of the input
+     * Preconditions: none
+     * Postconditions: returns false if there are no records left
+     * @param fields : set to a tokenizer over the next record
+     * @return true : if a record was found
+     */
+    bool nextRecord(FieldTokenizer& fields);
+};
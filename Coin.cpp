@@ -32,8 +32,30 @@ Coin::Coin(const Coin& c) {
 	typeCol = c.typeCol;
 	year = c.year;
 	count = c.count;
-	key = c.key;
 	type = c.type;
+	packed = c.packed;
+	fingerprint = c.fingerprint;
+	row = c.row;
+	id = c.id;
+}
+
+/**
+* @brief Construct a new Coin object
+* this function takes over the data of an instance of Coin
+* so a Coin can be moved without copying its strings
+* @param c : instance of coin that is moved from
+*/
+Coin::Coin(Coin&& c) noexcept {
+
+	grade = c.grade;
+	typeCol = move(c.typeCol);
+	year = c.year;
+	count = c.count;
+	type = c.type;
+	packed = c.packed;
+	fingerprint = c.fingerprint;
+	row = c.row;
+	id = c.id;
 }
 
 /**
@@ -42,30 +64,57 @@ Coin::Coin(const Coin& c) {
  * of coin based on the string
  * @param desc : whole description of the coin
  */
-Coin::Coin(string desc)
+Coin::Coin(string_view desc)
 {
+	FieldTokenizer fields(desc);
+	parse(fields);
+}
 
-	string str(desc);
-
-	vector<string> v;
-	stringstream ss(desc);
+/**
+ * @brief Construct a new Coin object
+ * this function sets the data members of Coin from the
+ * fields of a description that is already being split
+ * @param fields : tokenizer positioned at the first field
+ */
+Coin::Coin(FieldTokenizer& fields)
+{
+	parse(fields);
+}
 
-	while (ss.good()) {
-		string substr;
-		getline(ss, substr, ',');
-		v.push_back(substr);
+/**
+* parse
+* this function sets the data members of Coin from
+* the fields of its description and checks that every
+* field is there and every number is valid
+* @param fields : tokenizer positioned at the first field
+* @return ParseError::None if the record is valid
+*/
+ParseError Coin::parse(FieldTokenizer& fields)
+{
+	//M, 3, 2001, 65, Lincoln Cent
+	string_view typeField;
+	string_view nameField;
+	ParseError error = ParseError::None;
+	if ((error = fields.nextText(typeField)) != ParseError::None ||
+		(error = fields.nextInt(count)) != ParseError::None ||
+		(error = fields.nextInt(year)) != ParseError::None ||
+		(error = fields.nextInt(grade)) != ParseError::None ||
+		(error = fields.nextText(nameField)) != ParseError::None) {
+		return error;
 	}
+	typeCol = typeField;
+	type = SymbolTable::intern(nameField);
 
-	typeCol = v[0];
-	count = stoi(v[1]);
-	year = stoi(v[2]);
-	grade = stoi(v[3]);
-	type = v[4];
-	type.erase(type.begin()); //delete space
-
-	key = typeCol + ", " + to_string(year) +
-		", " + to_string(grade) + ", " + type;
-
+	packed.tag = tag;
+	packed.prefix = PackedKey::makePrefix(nameField);
+	packed.high = PackedKey::pack(type, 0);
+	packed.low = PackedKey::pack(PackedKey::bias(year), PackedKey::bias(grade));
+	//the key is built in a reused buffer so nothing is allocated
+	static thread_local string keyBuffer;
+	keyBuffer.clear();
+	appendFields(keyBuffer, nameField);
+	fingerprint = Fingerprint::of(keyBuffer);
+	return ParseError::None;
 }
 
 /**
@@ -114,20 +163,16 @@ bool Coin::operator<(const Comparable& colToCompare) const
 {
 	const Coin& coin = static_cast<const Coin&>(colToCompare);
 	//sorted by greatest in heap so want 3 before 10
-	if (this->type < coin.type) {
-		return true;
+	if (packed.prefix != coin.packed.prefix) {
+		return packed.prefix < coin.packed.prefix;
 	}
-	else if (this->type == coin.type) {
-		if (this->year < coin.year) {
-			return true;
-		}
-		else if (this->year == coin.year) {
-			if (this->grade < coin.grade) {
-				return true;
-			}
-		}
+	//types that share the prefix are compared as strings, ids are
+	//in the order the types were read
+	if (this->type != coin.type) {
+		return SymbolTable::getName(this->type) < SymbolTable::getName(coin.type);
 	}
-	return false;
+	//year then grade
+	return packed.low < coin.packed.low;
 }
 
 /**
@@ -154,10 +199,7 @@ bool Coin::operator>(const Comparable& rhs) const {
 */
 bool Coin::operator==(const Comparable& colToCompare) const {
 	const Coin& coin = static_cast<const Coin&>(colToCompare);
-	if (key == coin.key) {
-		return true;
-	}
-	return false;
+	return packed == coin.packed;
 }
 
 /**
@@ -182,13 +224,66 @@ Comparable* Coin::copy(const Comparable& c) {
 	return ptr;
 }
 
+/**
+* appendKey
+* this function appends the key of the Collectible to key
+* @param key : string the key is appended to
+*/
+void Coin::appendKey(string& key) const {
+	appendFields(key, SymbolTable::getName(type));
+}
+
+/**
+* appendFields
+* this function appends the key of the Coin to key with the
+* given type name, parse passes the field it read so it does
+* not look the name up in the SymbolTable
+* @param key : string the key is appended to
+* @param typeName : name of the coin type
+*/
+void Coin::appendFields(string& key, string_view typeName) const {
+	key.reserve(key.size() + typeCol.size() + typeName.size() + 16);
+	key.append(typeCol).append(", ");
+	FieldTokenizer::appendInt(key, year);
+	key.append(", ");
+	FieldTokenizer::appendInt(key, grade);
+	key.append(", ").append(typeName);
+}
+
 /**getKey
 * this function returns key for Collectible
 */
 string Coin::getKey() const {
+	string key;
+	appendKey(key);
 	return key;
 }
 
+/**
+* hashCode
+* this function returns a hash of the fields and the count
+* of the Coin in inventory
+*/
+size_t Coin::hashCode() const {
+	size_t h = (static_cast<size_t>(type) << 32) ^
+		(static_cast<size_t>(year) << 8) ^ static_cast<size_t>(grade);
+	return hash<size_t>()(h) ^ (static_cast<size_t>(count) * 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+* getColumns
+* this function returns the fields of the Coin
+* as they are stored in a ColumnStore
+*/
+ColumnRow Coin::getColumns() const {
+	ColumnRow columns;
+	columns.count = count;
+	columns.year = year;
+	columns.grade = static_cast<uint32_t>(grade);
+	columns.first = type;
+	return columns;
+}
+
 /**
  * print
  * this function prints the description
@@ -197,6 +292,6 @@ string Coin::getKey() const {
 void Coin::print() const
 {
 	cout << " Item: ";
-	cout << key << " (" << count << " left in store)" << endl;
+	cout << getKey() << " (" << count << " left in store)" << endl;
 }
 
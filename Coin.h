@@ -21,6 +21,9 @@
  */
 
 #include "Collectible.h"
+#include "FieldTokenizer.h"
+#include "ParseResult.h"
+#include "SymbolTable.h"
 
 
 class Coin : public Collectible
@@ -29,12 +32,36 @@ private:
     string typeCol = "";
     int count = 0;
     int grade = 0; // the grade for the coin
-    string type = "";
+    uint32_t type = 0; // interned coin type
     int year = 0;
-    string key = "";
 
+    /**
+    * appendFields
+    * this function appends the key of the Coin to key with the
+    * given type name, parse passes the field it read so it does
+    * not look the name up in the SymbolTable
+    * @param key : string the key is appended to
+    * @param typeName : name of the coin type
+    */
+    void appendFields(string& key, string_view typeName) const;
 
 public:
+    //registry entry: first character of a coin record and how
+    //a ColumnStore prints it
+    static constexpr char tag = 'M';
+    static constexpr bool namedGrades = false;
+    static constexpr bool hasSecond = false;
+
+    /**
+    * parse
+    * this function sets the data members of Coin from
+    * the fields of its description and checks that every
+    * field is there and every number is valid
+    * @param fields : tokenizer positioned at the first field
+    * @return ParseError::None if the record is valid
+    */
+    ParseError parse(FieldTokenizer& fields);
+
     /**
      * @brief Construct a new Coin object
      *
@@ -50,13 +77,39 @@ public:
      */
     Coin(const Coin& c);
 
+    /**
+     * @brief Construct a new Coin object
+     * this function takes over the data of an instance of Coin
+     * so a Coin can be moved without copying its strings
+     * @param c : instance of coin that is moved from
+     */
+    Coin(Coin&& c) noexcept;
+
+    /**
+     * operator=
+     * this function copies or moves the data members of c
+     * into this Coin
+     * @param c : instance of coin
+     * @return Coin& : this Coin
+     */
+    Coin& operator=(const Coin& c) = default;
+    Coin& operator=(Coin&& c) = default;
+
     /**
      * @brief Construct a new Coin object
      * this function takes in a string and sets the data members
      * of coin based on the string
      * @param desc : whole description of the coin
      */
-    Coin(string desc);
+    Coin(string_view desc);
+
+    /**
+     * @brief Construct a new Coin object
+     * this function sets the data members of Coin from the
+     * fields of a description that is already being split
+     * @param fields : tokenizer positioned at the first field
+     */
+    Coin(FieldTokenizer& fields);
 
     /**
      * @brief Destroy the Coin object
@@ -141,11 +194,32 @@ public:
     */
     Comparable* copy(const Comparable& c) override;
 
+    /**
+    * appendKey
+    * this function appends the key of the Collectible to key
+    * @param key : string the key is appended to
+    */
+    void appendKey(string& key) const override;
+
     /**getKey
     * this function returns key for Collectible
     */
     string getKey() const override;
 
+    /**
+    * hashCode
+    * this function returns a hash of the key and the count
+    * of the Coin in inventory
+    */
+    size_t hashCode() const override;
+
+    /**
+    * getColumns
+    * this function returns the fields of the Coin
+    * as they are stored in a ColumnStore
+    */
+    ColumnRow getColumns() const override;
+
     /**
      * print
      * this function prints the description
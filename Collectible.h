@@ -10,6 +10,9 @@
  *
  * Features:
  * -sorts based on type (M, S, C)
+ * -packed binary key for fast compares
+ * -cached fingerprint of the key for hashing
+ * -dense ID the indexes and the transaction history use
  * -prints in sorted order
  *
  * @version 0.1
@@ -24,10 +27,20 @@
 #include <sstream>
 #include <vector>
 #include "Comparable.h"
+#include "PackedKey.h"
+#include "FieldTokenizer.h"
+#include "Fingerprint.h"
+#include "ColumnStore.h"
 
 class Collectible : public Comparable
 {
 
+protected:
+	PackedKey packed; // binary key, set when the Collectible is parsed
+	uint64_t fingerprint = 0; // Fingerprint of getKey, set when parsed
+	int row = -1; // row in the ColumnStore of its type, -1 if none
+	uint32_t id = UINT32_MAX; // ID in the Inventory, UINT32_MAX if none
+
 public:
 	/**
 	 * @brief Construct a new Collectible object
@@ -124,11 +137,113 @@ public:
 	*/
 	virtual string getKey() const = 0;
 
+	/**
+	* appendKey
+	* this function appends the key of the Collectible to key
+	* without making a new string
+	* @param key : string the key is appended to
+	*/
+	virtual void appendKey(string& key) const = 0;
+
+	/**
+	* getPackedKey
+	* this function returns the binary key of the Collectible,
+	* equal Collectibles have equal packed keys
+	* Preconditions: none
+	* Postconditions: returns the packed key
+	*/
+	const PackedKey& getPackedKey() const {
+		return packed;
+	}
+
+	/**
+	* getFingerprint
+	* this function returns the Fingerprint of the key of the
+	* Collectible, it is computed once when the Collectible is parsed
+	* Preconditions: none
+	* Postconditions: returns the fingerprint
+	*/
+	uint64_t getFingerprint() const {
+		return fingerprint;
+	}
+
+	/**
+	* getRow
+	* Preconditions: none
+	* Postconditions: returns the row of the Collectible in the
+	* ColumnStore of its type, -1 if it is not stored
+	*/
+	int getRow() const {
+		return row;
+	}
+
+	/**
+	* setRow
+	* Preconditions: none
+	* Postconditions: the row of the Collectible is r
+	* @param r : row in the ColumnStore of its type
+	*/
+	void setRow(int r) {
+		row = r;
+	}
+
+	/**
+	* getId
+	* Preconditions: none
+	* Postconditions: returns the ID of the Collectible in the
+	* Inventory, UINT32_MAX if it is not in one
+	*/
+	uint32_t getId() const {
+		return id;
+	}
+
+	/**
+	* setId
+	* Preconditions: none
+	* Postconditions: the ID of the Collectible is i
+	* @param i : ID in the Inventory
+	*/
+	void setId(uint32_t i) {
+		id = i;
+	}
+
+	/**
+	* getColumns
+	* this function returns the fields of the Collectible
+	* as they are stored in a ColumnStore
+	* Preconditions: none
+	* Postconditions: returns the fields
+	*/
+	virtual ColumnRow getColumns() const = 0;
+
+	/**
+	* hashCode
+	* this function returns a hash of the Collectible's key and
+	* the count of it in inventory
+	*/
+	virtual size_t hashCode() const = 0;
+
 	/**
 	* print
 	* this function prints Comparable
 	*/
 	virtual void print() const = 0;
+
+	/**
+	* appendPrint
+	* this function appends the line print() displays to out so
+	* many Collectibles can be written at once
+	* Preconditions: none
+	* Postconditions: the line is appended to out
+	* @param out : string the line is appended to
+	*/
+	void appendPrint(string& out) const {
+		out.append(" Item: ");
+		appendKey(out);
+		out.append(" (");
+		FieldTokenizer::appendInt(out, getCount());
+		out.append(" left in store)\n");
+	}
 };
 
 
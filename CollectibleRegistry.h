@@ -0,0 +1,215 @@
+#pragma once
+/*
+ * @file CollectibleRegistry.h
+ * @author Katarina McGaughy
+ * CollectibleRegistry is built at compile time from the types in
+ * CollectibleValue. Every registered type declares its tag (the first
+ * character of its records), is parsed and checked by its parse
+ * function, ordered by its operator< and gets its own ordered list
+ * and ColumnStore in the Inventory. A 256 entry table maps a tag to
+ * the index of its type so records are dispatched with one lookup.
+ * Adding a type only needs the class and its entry in CollectibleValue.
+ *
+ * Features:
+ * -find the index of the type of a tag
+ * -parse a record into a CollectibleValue
+ * -create a Collectible on the heap
+ * -make the ColumnStores of every type
+ * -run code once for every registered type
+ *
+ * Assumptions:
+ * -every type has a different tag
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <array>
+#include <utility>
+#include <vector>
+#include <cstdint>
+#include "CollectibleValue.h"
+#include "ColumnStore.h"
+#include "FieldTokenizer.h"
+#include "ParseResult.h"
+using namespace std;
+
+class CollectibleRegistry
+{
+public:
+    //number of registered types
+    static constexpr size_t numTypes = variant_size_v<CollectibleValue>;
+
+    //registered type at index I
+    template <size_t I>
+    using TypeAt = variant_alternative_t<I, CollectibleValue>;
+
+private:
+    using Parser = ParseError (*)(FieldTokenizer&, CollectibleValue&);
+    using Creator = Collectible* (*)(FieldTokenizer&, ParseError&);
+
+    /**
+     * parseAs
+     * this function constructs the type at index I in value
+     * and parses the record into it
+     * @param fields : tokenizer positioned at the first field
+     * @param value : set to the new Collectible
+     * @return ParseError::None if the record is valid
+     */
+    template <size_t I>
+    static ParseError parseAs(FieldTokenizer& fields, CollectibleValue& value) {
+        value.template emplace<I>();
+        return get<I>(value).parse(fields);
+    }
+
+    /**
+     * createAs
+     * this function constructs the type at index I on the heap
+     * @param fields : tokenizer positioned at the first field
+     * @param error : set to why the record is not valid
+     * @return nullptr if the record is not valid
+     */
+    template <size_t I>
+    static Collectible* createAs(FieldTokenizer& fields, ParseError& error) {
+        TypeAt<I>* col = new TypeAt<I>();
+        error = col->parse(fields);
+        if (error != ParseError::None) {
+            delete col;
+            return nullptr;
+        }
+        return col;
+    }
+
+    /**
+     * tagIndex
+     * this function finds the type of the record
+     * @param line : whole record
+     * @param error : set to EmptyRecord or UnknownType if the record
+     * has no type
+     * @return index of the type, -1 if it has none
+     */
+    static int tagIndex(string_view line, ParseError& error) {
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == string_view::npos) {
+            error = ParseError::EmptyRecord;
+            return -1;
+        }
+        int index = first == 0 ? indexOf(line[0]) : -1;
+        error = index < 0 ? ParseError::UnknownType : ParseError::None;
+        return index;
+    }
+
+    /**
+     * makeTagTable
+     * this function maps every tag to the index of its type and
+     * every other character to -1
+     */
+    template <size_t... I>
+    static constexpr array<int8_t, 256> makeTagTable(index_sequence<I...>) {
+        array<int8_t, 256> table{};
+        for (size_t c = 0; c < table.size(); c++) {
+            table[c] = -1;
+        }
+        ((table[static_cast<unsigned char>(TypeAt<I>::tag)] = static_cast<int8_t>(I)), ...);
+        return table;
+    }
+
+    template <size_t... I>
+    static constexpr array<Parser, numTypes> makeParsers(index_sequence<I...>) {
+        return { &parseAs<I>... };
+    }
+
+    template <size_t... I>
+    static constexpr array<Creator, numTypes> makeCreators(index_sequence<I...>) {
+        return { &createAs<I>... };
+    }
+
+    template <class F, size_t... I>
+    static void forEachType(F& f, index_sequence<I...>) {
+        (f(integral_constant<size_t, I>()), ...);
+    }
+
+public:
+
+    /**
+     * indexOf
+     * Preconditions: none
+     * Postconditions: returns the index of the type with tag,
+     * -1 if no type has it
+     * @param tag : first character of a record
+     */
+    static int indexOf(char tag) {
+        static constexpr array<int8_t, 256> tagTable =
+            makeTagTable(make_index_sequence<numTypes>());
+        return tagTable[static_cast<unsigned char>(tag)];
+    }
+
+    /**
+     * parse
+     * this function constructs the type of the record in value
+     * Preconditions: none
+     * Postconditions: returns why the record is not valid,
+     * ParseError::None if value holds the new Collectible
+     * @param fields : tokenizer positioned at the first field
+     * @param value : set to the new Collectible
+     */
+    static ParseError parse(FieldTokenizer& fields, CollectibleValue& value) {
+        ParseError error;
+        int index = tagIndex(fields.getLine(), error);
+        if (index < 0) {
+            return error;
+        }
+        static constexpr array<Parser, numTypes> parsers =
+            makeParsers(make_index_sequence<numTypes>());
+        return parsers[index](fields, value);
+    }
+
+    /**
+     * create
+     * this function constructs the type of the record on the heap
+     * Preconditions: none
+     * Postconditions: returns nullptr if the record is not valid
+     * @param fields : tokenizer positioned at the first field
+     * @param error : set to why the record is not valid
+     */
+    static Collectible* create(FieldTokenizer& fields, ParseError& error) {
+        int index = tagIndex(fields.getLine(), error);
+        if (index < 0) {
+            return nullptr;
+        }
+        static constexpr array<Creator, numTypes> creators =
+            makeCreators(make_index_sequence<numTypes>());
+        return creators[index](fields, error);
+    }
+
+    /**
+     * forEachType
+     * this function calls f once for every registered type in order
+     * with an integral_constant holding the index of the type
+     * Preconditions: none
+     * Postconditions: f is called numTypes times
+     * @param f : function to call
+     */
+    template <class F>
+    static void forEachType(F&& f) {
+        forEachType(f, make_index_sequence<numTypes>());
+    }
+
+    /**
+     * makeColumnStores
+     * Preconditions: none
+     * Postconditions: returns an empty ColumnStore for every
+     * registered type in order
+     */
+    static vector<ColumnStore> makeColumnStores() {
+        vector<ColumnStore> stores;
+        stores.reserve(numTypes);
+        forEachType([&stores](auto index) {
+            using T = TypeAt<decltype(index)::value>;
+            stores.emplace_back(T::tag, T::namedGrades, T::hasSecond);
+        });
+        return stores;
+    }
+};
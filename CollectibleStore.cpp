@@ -22,6 +22,7 @@
  */
 
 #include <vector>
+#include <thread>
 #include "CustomerList.h"
 #include "Inventory.h"
 
@@ -35,6 +36,10 @@
 CollectibleStore::CollectibleStore() {
 	cList = new CustomerList(); 
 	iList = new Inventory();
+	cList->setJournal(&journal);
+	//the journal keeps IDs and finds the objects in the lists
+	journal.setIdTables(&cList->getIds(), &iList->getIds());
+	setLoadThreads(static_cast<int>(thread::hardware_concurrency()));
 }
 
 /**
@@ -44,77 +49,236 @@ CollectibleStore::CollectibleStore() {
  */
 CollectibleStore::~CollectibleStore() {
 
-	//set customerList and inventoryList to nullptr
+	//customers point into the inventory so they go first
+	delete cList;
+	delete iList;
 	cList = nullptr;
 	iList = nullptr;
 }
 
+/**
+ * setLoadThreads
+ * this function sets the number of threads the inventory
+ * is loaded with
+ * Preconditions: none
+ * Postconditions: loadThreads is at least 1
+ * @param threads : number of threads
+ */
+void CollectibleStore::setLoadThreads(int threads) {
+	loadThreads = threads < 1 ? 1 : threads;
+}
+
+/**
+ * setQuarantineFile
+ * this function sets the file the inventory records that
+ * are not valid are copied to
+ * Preconditions: none
+ * Postconditions: bad records are written to path on the
+ * next load, an empty path turns this off
+ * @param path : file to write the bad records to
+ */
+void CollectibleStore::setQuarantineFile(const string& path) {
+	quarantineFile = path;
+}
+
+/**
+ * splitChunks
+ * this function splits data into at most count parts that
+ * end on a newline
+ * Preconditions: count must be at least 1
+ * Postconditions: returns the parts in order
+ * @param data : text to split
+ * @param count : number of parts wanted
+ */
+vector<string_view> CollectibleStore::splitChunks(string_view data, size_t count) {
+	vector<string_view> chunks;
+	size_t start = 0;
+	for (size_t c = 1; c < count && start < data.size(); c++) {
+		size_t end = data.find('\n', max(start, data.size() * c / count));
+		if (end == string_view::npos) {
+			break;
+		}
+		chunks.push_back(data.substr(start, end + 1 - start));
+		start = end + 1;
+	}
+	if (start < data.size() || chunks.empty()) {
+		chunks.push_back(data.substr(start));
+	}
+	return chunks;
+}
+
+/**
+ * parseInventoryChunk
+ * this function creates the Collectibles of every record in
+ * chunk in order, records that are not valid are added
+ * to rejected instead of being printed
+ * Preconditions: none
+ * Postconditions: collectibles holds the new Collectibles
+ * @param chunk : records to parse
+ * @param collectibles : vector the Collectibles are added to
+ * @param rejected : vector the records that are not valid are added to
+ */
+void CollectibleStore::parseInventoryChunk(string_view chunk,
+	vector<CollectibleValue>& collectibles, vector<RejectedRecord>& rejected) {
+	BulkLoader loader(chunk);
+	FieldTokenizer fields("");
+	CollectibleValue col;
+	while (loader.nextRecord(fields)) {
+		ParseError error = i.createValue(fields, col, false);
+		if (error == ParseError::None) {
+			collectibles.push_back(move(col));
+		}
+		else {
+			rejected.push_back({ fields.getLine(), error });
+		}
+	}
+}
+
+/**
+ * reportRejected
+ * this function prints why every rejected record was skipped,
+ * counts them by error in stats and copies them to the
+ * quarantine file if there is one
+ * Preconditions: rejected must be in file order
+ * Postconditions: stats holds the count of every error
+ * @param rejected : records that are not valid of every chunk
+ * @param stats : counts of the errors
+ */
+void CollectibleStore::reportRejected(const vector<vector<RejectedRecord>>& rejected,
+	ParseStats& stats) {
+	ofstream quarantine;
+	for (size_t c = 0; c < rejected.size(); c++) {
+		for (size_t r = 0; r < rejected[c].size(); r++) {
+			const RejectedRecord& bad = rejected[c][r];
+			i.reportInvalid(bad.line, bad.error);
+			stats.record(bad.error);
+			//empty lines are only counted
+			if (quarantineFile.empty() || bad.error == ParseError::EmptyRecord) {
+				continue;
+			}
+			if (!quarantine.is_open()) {
+				quarantine.open(quarantineFile);
+			}
+			quarantine << bad.line << '\n';
+		}
+	}
+}
+
+/**
+ * setCompaction
+ * this function sets when the journal is compacted, which
+ * transactions stay in memory and the file the rest are
+ * spilled to
+ * Preconditions: no commands have been run
+ * Postconditions: the journal is compacted as commands run
+ * @param policy : when to compact and what to keep
+ * @param path : file the transactions are spilled to
+ */
+void CollectibleStore::setCompaction(const CompactionPolicy& policy, const string& path) {
+	compaction = policy;
+	nextCompaction = policy.maxRows;
+	segment.setPath(path);
+	journal.setSegment(&segment);
+}
+
+/**
+ * compactIfNeeded
+ * this function compacts the journal once it has reached
+ * nextCompaction rows, the next compaction waits until the
+ * journal has grown to twice what was kept
+ * Preconditions: none
+ * Postconditions: the journal has fewer than nextCompaction rows
+ * or nothing could be spilled
+ */
+void CollectibleStore::compactIfNeeded() {
+	if (journal.size() < nextCompaction || !segment.hasPath()) {
+		return;
+	}
+	cList->compactHistory(compaction);
+	nextCompaction = max(compaction.maxRows, journal.size() * 2);
+}
+
 /**
  * @brief initializeInventory
- * reads in a file line by line and initializes collectible items
+ * splits a mapped file into records and initializes collectible items
  * and creates a hash table of items as well as a sorted list of
- * items in the Inventory class
+ * items in the Inventory class. large files are split into chunks
+ * that are parsed and sorted on several threads
  * Preconditions: file must exist
  * Postconditions: Inventory is built
  */
-void CollectibleStore::initializeInventory(ifstream& infile) {
+void CollectibleStore::initializeInventory(const InputSource& infile) {
 	cout << "Initializing inventory: " << endl;
-	vector<Object*> collectibles;
-	vector<string> keys;
-	string line;
-	while (getline(infile, line)) {
-		Collectible* col;
-		col = i.createCollectible(line);
-		if (col != nullptr) {
-			collectibles.push_back(col);
-			keys.push_back(col->getKey());
-		}
+	string_view data = infile.getData();
+	size_t numChunks = min(static_cast<size_t>(loadThreads),
+		max(data.size() / minChunkSize, static_cast<size_t>(1)));
+	vector<string_view> chunks = splitChunks(data, numChunks);
+
+	//parse every chunk, the first one on this thread
+	vector<vector<CollectibleValue>> parsed(chunks.size());
+	vector<vector<RejectedRecord>> rejected(chunks.size());
+	vector<thread> workers;
+	for (size_t c = 1; c < chunks.size(); c++) {
+		workers.emplace_back(&CollectibleStore::parseInventoryChunk, this,
+			chunks[c], ref(parsed[c]), ref(rejected[c]));
+	}
+	parseInventoryChunk(chunks[0], parsed[0], rejected[0]);
+	for (size_t w = 0; w < workers.size(); w++) {
+		workers[w].join();
 	}
-	iList->buildInventory(collectibles, keys);
-	iList->displayInventory();
 
-	for (int i = 0; i < collectibles.size(); i++) {
-		collectibles[i] = nullptr;
+	//merge the chunks back in file order, the first chunk is
+	//taken over so a single chunk is never copied
+	size_t total = 0;
+	for (size_t c = 0; c < chunks.size(); c++) {
+		total += parsed[c].size();
 	}
-	
+	vector<CollectibleValue> collectibles = move(parsed[0]);
+	collectibles.reserve(total);
+	ParseStats stats;
+	reportRejected(rejected, stats);
+	for (size_t c = 1; c < chunks.size(); c++) {
+		for (size_t p = 0; p < parsed[c].size(); p++) {
+			collectibles.push_back(move(parsed[c][p]));
+		}
+		parsed[c].clear();
+	}
+	stats.report("inventory");
+	iList->buildInventory(move(collectibles), static_cast<int>(chunks.size()));
+	iList->displayInventory();
 }
 
 /**
  * @brief initializeCustomers
- * reads in a file line by line and initializes customers
+ * splits a mapped file into records and initializes customers
  * and creates a hash table of customers with their ID as the key
  *  as well as creates a sorted list of customers (alphabetical)
  * in the CustomerList class
  * Preconditions: file must exist
- * Postconditions: CustomerList is built
+ * Postconditions: CustomerList is built, a customer whose ID is
+ * already used is reported and dropped
  */
-void CollectibleStore::initializeCustomers(ifstream& infile) {
+void CollectibleStore::initializeCustomers(const InputSource& infile) {
 
 	cout << "Initializing customers: " << endl;
-	vector<string> keys;
-	vector<Object*> customers;
-	string line;
-	while (getline(infile, line)) {
-		customers.push_back(new Customer(line));
-	}
-	for (int i = 0; i < customers.size(); i++) {
-		
-		const Customer* s = dynamic_cast<const Customer*>(customers[i]);
-		keys.push_back(s->getCustomerID());
+	vector<unique_ptr<Customer>> customers;
+	BulkLoader loader(infile);
+	FieldTokenizer fields("");
+	while (loader.nextRecord(fields)) {
+		customers.push_back(make_unique<Customer>(fields));
 	}
 
-	//build customerLists
-	cList->buildCustomerList(customers, keys);
-	cList->displayCustomers();
-
-	for (int i = 0; i < customers.size(); i++) {
-		customers[i] = nullptr;
+	//build customerLists, cList owns the customers from here on
+	vector<string> repeated = cList->buildCustomerList(move(customers));
+	for (size_t i = 0; i < repeated.size(); i++) {
+		cout << "Customer: " << repeated[i] << " already exists.Try again." << endl;
 	}
+	cList->displayCustomers();
 }
 
 /**
  * getCommands
- * this function reads in commands from a file and
+ * this function splits a mapped file into commands and
  * initializes them via the CommandFactory and
  * stores them in the commands vector
  * Preconditions: file must be in the correct format
@@ -122,14 +286,15 @@ void CollectibleStore::initializeCustomers(ifstream& infile) {
  *
  * @param file : file of commands
  */
-void CollectibleStore::getCommands(ifstream& infile) {
+void CollectibleStore::getCommands(const InputSource& infile) {
 
 
 	vector<Command*> listCommands;
-	string line;
-	while (getline(infile, line)) {
+	BulkLoader loader(infile);
+	FieldTokenizer fields("");
+	while (loader.nextRecord(fields)) {
 		Command* newCommand;
-		newCommand = c.createCommand(line);
+		newCommand = c.createCommand(string(fields.getLine()));
 		//need to ensure commands are valid 
 		if (newCommand != nullptr) {
 			listCommands.push_back(newCommand);
@@ -147,8 +312,9 @@ void CollectibleStore::getCommands(ifstream& infile) {
  */
 void CollectibleStore::executeCommands(vector<Command*> commandList) {
 
-	for (int i = 0; i < commandList.size(); i++) {
+	for (size_t i = 0; i < commandList.size(); i++) {
 		commandList[i]->Execute(cList, iList);
+		compactIfNeeded();
 		//delete commands
 		delete commandList[i];
 		commandList[i] = nullptr;
@@ -185,6 +351,27 @@ CollectibleStore::Command* CollectibleStore::CommandFactory::createCommand(strin
 	else if (firstChar == 'H') {
 		return new History(desc);
 	}
+	else if (firstChar == 'L') {
+		return new LowStock(desc);
+	}
+	else if (firstChar == 'Y') {
+		return new YearRange(desc);
+	}
+	else if (firstChar == 'I') {
+		return new ItemHistory(desc);
+	}
+	else if (firstChar == 'R') {
+		return new Report(desc);
+	}
+	else if (firstChar == 'T') {
+		return new TopSellers(desc);
+	}
+	else if (firstChar == 'N') {
+		return new NameSearch(desc);
+	}
+	else if (firstChar == 'A') {
+		return new AddCustomer(desc);
+	}
 	cout << "Command: " << desc;
 	cout << " is not recognized.Try again." << endl;
 	cout << endl;
@@ -203,24 +390,15 @@ CollectibleStore::Command* CollectibleStore::CommandFactory::createCommand(strin
 */
 void CollectibleStore::Sell::Execute(CustomerList* cList, Inventory* iList) {
 
-	//B, 456, M, 1913, 70, Liberty Nickel
-
-	string str(command);
-
-	vector<string> v;
-	stringstream ss(str);
+	//S, 456, M, 1913, 70, Liberty Nickel
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	fields.next(field);
+	string customerID(field);
 
-	while (ss.good()) {
-		string substr;
-		getline(ss, substr, ',');
-		v.push_back(substr);
-	}
-
-	string customerID = v[1];
-
-	string colDesc = command;
 	//colDesc is now just the type, year, grade, and name
-	colDesc.erase(0, 8);
+	string colDesc(fields.rest());
 	//cout << "Printing description when reading in a buy command:(2) ";
 	//cout << colDesc << endl;
 
@@ -235,7 +413,7 @@ void CollectibleStore::Sell::Execute(CustomerList* cList, Inventory* iList) {
 			cu->purchaseItem(co);
 			//decrement by one in inventory 
 			count--;
-			co->setCount(count);
+			iList->updateCount(co, count);
 		}
 		else {
 			cout << "Inventory for collectible item: " << co->getKey();
@@ -268,22 +446,16 @@ void CollectibleStore::Buy::Execute(CustomerList* cList, Inventory* iList) {
 	//B, 456, M, 1913, 70, Liberty Nickel
 
 	//parse string to get item and customer ID 
-	string str(command);
-	vector<string> v;
-	stringstream ss(str);
-
-	while (ss.good()) {
-		string substr;
-		getline(ss, substr, ',');
-		v.push_back(substr);
-	}
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	fields.next(field);
 
 	//set customerID
-	string customerID = v[1];
+	string customerID(field);
 
-	string colDesc = command;
 	//colDesc is now just the type, year, grade, and name
-	colDesc.erase(0, 8);
+	string colDesc(fields.rest());
 	//cout << "Printing description when reading in a buy command:(2) ";
 	//cout << colDesc << endl;
 
@@ -299,7 +471,7 @@ void CollectibleStore::Buy::Execute(CustomerList* cList, Inventory* iList) {
 			cu->sellItem(co);
 			//decrement by one in inventory 
 			count++;
-			co->setCount(count);
+			iList->updateCount(co, count);
 		}
 		else {
 			cout << "Customer: " << customerID << " does not have item: " << co->getKey();
@@ -342,23 +514,70 @@ void CollectibleStore::Display::Execute(CustomerList* cList, Inventory* iList) {
 */
 void CollectibleStore::CustomerDisplay::Execute(CustomerList* cList, Inventory* iList) {
 
-	cout << "(C) Displaying single customer: " << endl;
-
+	//C, 456 or C, 456, 2026-10-01, 2026-10-17 and either can end
+	//with an offset and limit: C, 456, 100, 50
 	//parse command to find customer
-	string str(command);
-	vector<string> v;
-	stringstream ss(str);
-
-	while (ss.good()) {
-		string substr;
-		getline(ss, substr, ',');
-		v.push_back(substr);
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	fields.next(field);
+	string customerID(field);
+
+	HistoryPage page;
+	string_view fromField;
+	string_view toField;
+	string_view first;
+	string_view second;
+	bool dated = false;
+	bool paged = false;
+	bool badPage = false;
+	if (fields.next(first)) {
+		//two numbers are a page, anything else a range of dates
+		int offset = 0;
+		int limit = 0;
+		bool hasSecond = fields.next(second);
+		if (hasSecond && FieldTokenizer::toInt(first, offset) &&
+			FieldTokenizer::toInt(second, limit)) {
+			paged = true;
+		}
+		else {
+			//an optional range of dates, both days included
+			fromField = first;
+			toField = second;
+			if (!hasSecond || !TransactionJournal::parseDate(fromField, page.from) ||
+				!TransactionJournal::parseDate(toField, page.to)) {
+				cout << "Command: " << command << " has a bad date.Try again." << endl;
+				cout << endl;
+				return;
+			}
+			page.to += 86399;
+			dated = true;
+			if (fields.next(first)) {
+				paged = fields.next(second) && FieldTokenizer::toInt(first, offset) &&
+					FieldTokenizer::toInt(second, limit);
+				badPage = !paged;
+			}
+		}
+		if (badPage || offset < 0 || limit < 0) {
+			cout << "Command: " << command << " has a bad page.Try again." << endl;
+			cout << endl;
+			return;
+		}
+		if (paged) {
+			page.offset = static_cast<size_t>(offset);
+			page.limit = static_cast<size_t>(limit);
+		}
 	}
 
-	string customerID = v[1];
-
+	if (dated) {
+		cout << "(C) Displaying single customer from " << fromField;
+		cout << " to " << toField << ": " << endl;
+	}
+	else {
+		cout << "(C) Displaying single customer: " << endl;
+	}
 	//display customer based on customer ID
-	cList->displaySingleCustomer(customerID);
+	cList->displaySingleCustomer(customerID, page);
 	cout << endl;
 
 }
@@ -376,10 +595,221 @@ void CollectibleStore::History::Execute(CustomerList* cList, Inventory* iList) {
 	cout << endl;
 }
 
+/**Execute
+* this functions takes in a CustomerList and InventoryList
+* and displays the Collectibles that are low in stock
+* Preconditions: CustomerList and InventoryList must be initialized
+* Postconditions: the Collectibles with a count at or below the
+* threshold are displayed in inventory order
+*/
+void CollectibleStore::LowStock::Execute(CustomerList* cList, Inventory* iList) {
+
+	//L, 2
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	int threshold = 0;
+	if (!fields.next(field) || !FieldTokenizer::toInt(field, threshold)) {
+		cout << "Command: " << command << " is missing a count.Try again." << endl;
+		cout << endl;
+		return;
+	}
+	cout << "(L) Displaying inventory with " << threshold << " or less left: " << endl;
+	iList->displayLowStock(threshold);
+	cout << endl;
+}
+
+/**Execute
+* this functions takes in a CustomerList and InventoryList
+* and displays the Collectibles made in a range of years
+* Preconditions: CustomerList and InventoryList must be initialized
+* Postconditions: the Collectibles made from the first year to the
+* last year are displayed in inventory order
+*/
+void CollectibleStore::YearRange::Execute(CustomerList* cList, Inventory* iList) {
+
+	//Y, 1950, 1990
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	int from = 0;
+	int to = 0;
+	if (!fields.next(field) || !FieldTokenizer::toInt(field, from) ||
+		!fields.next(field) || !FieldTokenizer::toInt(field, to)) {
+		cout << "Command: " << command << " is missing a year.Try again." << endl;
+		cout << endl;
+		return;
+	}
+	cout << "(Y) Displaying inventory from " << from << " to " << to << ": " << endl;
+	iList->displayYears(from, to);
+	cout << endl;
+}
+
+/**Execute
+* this functions takes in a CustomerList and InventoryList
+* and displays the transactions of a Collectible
+* Preconditions: CustomerList and InventoryList must be initialized
+* Postconditions: if the collectible exists its transactions are
+* displayed in order, if not an error message is displayed
+*/
+void CollectibleStore::ItemHistory::Execute(CustomerList* cList, Inventory* iList) {
 
+	//I, M, 1913, 70, Liberty Nickel
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	string colDesc(fields.rest());
 
+	Object* col = iList->getCollectible(colDesc);
+	if (col == nullptr || cList->getJournal() == nullptr) {
+		cout << "Collectible: " << colDesc << " does not exist.Try again." << endl;
+		cout << endl;
+		return;
+	}
+	Collectible* co = dynamic_cast<Collectible*>(col);
+	cout << "(I) Displaying transactions for item: " << co->getKey() << endl;
+	cList->getJournal()->displayItem(co);
+	cout << endl;
+}
 
+/**Execute
+* this functions takes in a CustomerList and InventoryList
+* and displays the totals of the store, or of a customer if
+* a customer ID is given
+* Preconditions: CustomerList and InventoryList must be initialized
+* Postconditions: the totals are displayed, if the customer
+* does not exist an error message is displayed
+*/
+void CollectibleStore::Report::Execute(CustomerList* cList, Inventory* iList) {
+
+	//R or R, 456
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	if (fields.next(field)) {
+		string customerID(field);
+		Object* cust = cList->getCustomer(customerID);
+		if (cust == nullptr) {
+			cout << "Customer: " << customerID << " does not exist.Try again." << endl;
+			cout << endl;
+			return;
+		}
+		cout << "(R) Displaying report for customer: " << customerID << endl;
+		dynamic_cast<Customer*>(cust)->displayTotals();
+		cout << endl;
+		return;
+	}
 
+	TransactionTotals totals;
+	if (cList->getJournal() != nullptr) {
+		totals = cList->getJournal()->getTotals();
+	}
+	long inStore = iList->getTotalCount();
+	cout << "(R) Displaying store report: " << endl;
+	cout << "Bought from store: " << totals.bought << endl;
+	cout << "Sold to store: " << totals.sold << endl;
+	cout << "Failed sales to store: " << totals.failed << endl;
+	cout << "Held by customers: " << totals.held() << endl;
+	cout << "Left in store: " << inStore << endl;
+	//turnover is the share of the stock that has gone out the door
+	long stock = inStore + totals.held();
+	long percent = stock == 0 ? 0 : totals.bought * 100 / stock;
+	cout << "Inventory turnover: " << percent << "%" << endl;
+	cout << endl;
+}
 
+/**Execute
+* this functions takes in a CustomerList and InventoryList
+* and displays the K items with the most units bought from the
+* store and the K customers with the most transactions
+* Preconditions: CustomerList and InventoryList must be initialized
+* Postconditions: the items and customers are displayed, most first
+*/
+void CollectibleStore::TopSellers::Execute(CustomerList* cList, Inventory* iList) {
+
+	//T, 5
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	int k = 0;
+	if (!fields.next(field) || !FieldTokenizer::toInt(field, k) || k < 0) {
+		cout << "Command: " << command << " is missing a count.Try again." << endl;
+		cout << endl;
+		return;
+	}
+	cout << "(T) Displaying top " << k << ": " << endl;
+	TransactionJournal* journal = cList->getJournal();
+	if (journal == nullptr) {
+		cout << endl;
+		return;
+	}
+	cout << "Best selling items:" << endl;
+	vector<TopCounter<uint32_t>::Entry> items = journal->getTopItems(k);
+	for (size_t i = 0; i < items.size(); i++) {
+		cout << items[i].count << " sold: ";
+		journal->getItemById(items[i].key)->print();
+	}
+	cout << "Most active customers:" << endl;
+	vector<TopCounter<uint32_t>::Entry> customers = journal->getTopCustomers(k);
+	for (size_t i = 0; i < customers.size(); i++) {
+		const Customer* customer = journal->getCustomerById(customers[i].key);
+		cout << customers[i].count << " transactions: ";
+		cout << customer->getCustomerID() << " ";
+		cout << customer->getName() << endl;
+	}
+	cout << endl;
+}
 
+/**Execute
+* this functions takes in a CustomerList and InventoryList
+* and displays every customer whose name starts with the
+* prefix in any case
+* Preconditions: CustomerList and InventoryList must be initialized
+* Postconditions: the customers are displayed in alphabetical
+* order, if there is no prefix an error message is displayed
+*/
+void CollectibleStore::NameSearch::Execute(CustomerList* cList, Inventory* iList) {
+
+	//N, don
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	if (!fields.next(field) || field.empty()) {
+		cout << "Command: " << command << " is missing a name.Try again." << endl;
+		cout << endl;
+		return;
+	}
+	cout << "(N) Displaying customers starting with: " << field << endl;
+	cList->displayNamePrefix(field);
+	cout << endl;
+}
 
+/**Execute
+* this functions takes in a CustomerList and InventoryList
+* and adds the customer with the ID and name of the command
+* Preconditions: CustomerList and InventoryList must be initialized
+* Postconditions: the customer can be used by the commands that
+* follow, if the ID is taken an error message is displayed
+*/
+void CollectibleStore::AddCustomer::Execute(CustomerList* cList, Inventory* iList) {
+
+	//A, 999, Daisy Duck
+	FieldTokenizer fields(command);
+	string_view field;
+	fields.next(field);
+	unique_ptr<Customer> customer = make_unique<Customer>(fields);
+	if (customer->getCustomerID().empty() || customer->getName().empty()) {
+		cout << "Command: " << command << " is missing a customer.Try again." << endl;
+		cout << endl;
+		return;
+	}
+	string customerID = customer->getCustomerID();
+	string name = customer->getName();
+	if (!cList->addCustomer(move(customer))) {
+		cout << "Customer: " << customerID << " already exists.Try again." << endl;
+		cout << endl;
+		return;
+	}
+	cout << "(A) Added customer: " << customerID << " " << name << endl;
+	cout << endl;
+}
@@ -30,6 +30,9 @@
 #include "Inventory.h"
 #include <fstream>
 #include "InventoryFactory.h"
+#include "BulkLoader.h"
+#include "InputSource.h"
+#include "TransactionJournal.h"
 
 class CollectibleStore : public Store {
 
@@ -39,8 +42,76 @@ private:
     CustomerList* cList = nullptr;
     //stores ordered list of inventory
     Inventory* iList = nullptr; 
+    //older transactions spilled out of the journal
+    HistorySegment segment;
+    //every transaction of the store in order
+    TransactionJournal journal;
+    //when the journal is compacted and what stays in memory
+    CompactionPolicy compaction;
+    //journal rows that start the next compaction
+    size_t nextCompaction = SIZE_MAX;
     //creates inventory items
     InventoryFactory i;
+    //number of threads the inventory is loaded with
+    int loadThreads = 1;
+    //smallest part of the inventory file given to one thread
+    static const size_t minChunkSize = 1 << 20;
+    //file bad inventory records are copied to, empty for none
+    string quarantineFile;
+
+    //record that could not be parsed and why
+    struct RejectedRecord {
+        string_view line;
+        ParseError error;
+    };
+
+    /**
+     * splitChunks
+     * this function splits data into at most count parts that
+     * end on a newline
+     * Preconditions: count must be at least 1
+     * Postconditions: returns the parts in order
+     * @param data : text to split
+     * @param count : number of parts wanted
+     */
+    static vector<string_view> splitChunks(string_view data, size_t count);
+
+    /**
+     * parseInventoryChunk
+     * this function creates the Collectibles of every record in
+     * chunk in order, records that are not valid are added
+     * to rejected instead of being printed
+     * Preconditions: none
+     * Postconditions: collectibles holds the new Collectibles
+     * @param chunk : records to parse
+     * @param collectibles : vector the Collectibles are added to
+     * @param rejected : vector the records that are not valid are added to
+     */
+    void parseInventoryChunk(string_view chunk, vector<CollectibleValue>& collectibles,
+        vector<RejectedRecord>& rejected);
+
+    /**
+     * reportRejected
+     * this function prints why every rejected record was skipped,
+     * counts them by error in stats and copies them to the
+     * quarantine file if there is one
+     * Preconditions: rejected must be in file order
+     * Postconditions: stats holds the count of every error
+     * @param rejected : records that are not valid of every chunk
+     * @param stats : counts of the errors
+     */
+    void reportRejected(const vector<vector<RejectedRecord>>& rejected, ParseStats& stats);
+
+    /**
+     * compactIfNeeded
+     * this function compacts the journal once it has reached
+     * nextCompaction rows, the next compaction waits until the
+     * journal has grown to twice what was kept
+     * Preconditions: none
+     * Postconditions: the journal has fewer than nextCompaction rows
+     * or nothing could be spilled
+     */
+    void compactIfNeeded();
 
     /*Command class is an interface for various types of commands
     * that can be performed on the CollectibleStore class
@@ -198,8 +269,186 @@ private:
 
     };
 
+    /* LowStock is a type of Command that will display the Collectibles
+     * whose inventory count is at or below a threshold
+     */
+    class LowStock : public Command {
+
+    public:
+
+        /**
+      * @brief Construct a new LowStock object
+      * takes in a string that represents command
+      * @param commandSpecs : sets this to command member variables
+      */
+        LowStock(string commandSpecs) : Command(commandSpecs) {}
+
+        /**Execute
+        * this functions takes in a CustomerList and InventoryList
+        * and displays the Collectibles that are low in stock
+        * Preconditions: CustomerList and InventoryList must be initialized
+        * Postconditions: the Collectibles with a count at or below the
+        * threshold are displayed in inventory order
+        */
+        void Execute(CustomerList* cList, Inventory* iList);
+
+    };
+
+    /* YearRange is a type of Command that will display the Collectibles
+     * made in a range of years
+     */
+    class YearRange : public Command {
+
+    public:
+
+        /**
+      * @brief Construct a new YearRange object
+      * takes in a string that represents command
+      * @param commandSpecs : sets this to command member variables
+      */
+        YearRange(string commandSpecs) : Command(commandSpecs) {}
+
+        /**Execute
+        * this functions takes in a CustomerList and InventoryList
+        * and displays the Collectibles made in a range of years
+        * Preconditions: CustomerList and InventoryList must be initialized
+        * Postconditions: the Collectibles made from the first year to the
+        * last year are displayed in inventory order
+        */
+        void Execute(CustomerList* cList, Inventory* iList);
+
+    };
+
+    /* ItemHistory is a type of Command that will display every
+     * transaction of one Collectible from the journal
+     */
+    class ItemHistory : public Command {
+
+    public:
+
+        /**
+      * @brief Construct a new ItemHistory object
+      * takes in a string that represents command
+      * @param commandSpecs : sets this to command member variables
+      */
+        ItemHistory(string commandSpecs) : Command(commandSpecs) {}
+
+        /**Execute
+        * this functions takes in a CustomerList and InventoryList
+        * and displays the transactions of a Collectible
+        * Preconditions: CustomerList and InventoryList must be initialized
+        * Postconditions: if the collectible exists its transactions are
+        * displayed in order, if not an error message is displayed
+        */
+        void Execute(CustomerList* cList, Inventory* iList);
+
+    };
+
+    /* Report is a type of Command that will display the running
+     * totals of the store or of one customer
+     */
+    class Report : public Command {
+
+    public:
+
+        /**
+      * @brief Construct a new Report object
+      * takes in a string that represents command
+      * @param commandSpecs : sets this to command member variables
+      */
+        Report(string commandSpecs) : Command(commandSpecs) {}
+
+        /**Execute
+        * this functions takes in a CustomerList and InventoryList
+        * and displays the totals of the store, or of a customer if
+        * a customer ID is given
+        * Preconditions: CustomerList and InventoryList must be initialized
+        * Postconditions: the totals are displayed, if the customer
+        * does not exist an error message is displayed
+        */
+        void Execute(CustomerList* cList, Inventory* iList);
+
+    };
+
+    /* TopSellers is a type of Command that will display the best
+     * selling items and the most active customers
+     */
+    class TopSellers : public Command {
+
+    public:
+
+        /**
+      * @brief Construct a new TopSellers object
+      * takes in a string that represents command
+      * @param commandSpecs : sets this to command member variables
+      */
+        TopSellers(string commandSpecs) : Command(commandSpecs) {}
+
+        /**Execute
+        * this functions takes in a CustomerList and InventoryList
+        * and displays the K items with the most units bought from the
+        * store and the K customers with the most transactions
+        * Preconditions: CustomerList and InventoryList must be initialized
+        * Postconditions: the items and customers are displayed, most first
+        */
+        void Execute(CustomerList* cList, Inventory* iList);
+
+    };
+
+    /* NameSearch is a type of Command that will display the
+     * customers whose name starts with a prefix
+     */
+    class NameSearch : public Command {
+
+    public:
+
+        /**
+      * @brief Construct a new NameSearch object
+      * takes in a string that represents command
+      * @param commandSpecs : sets this to command member variables
+      */
+        NameSearch(string commandSpecs) : Command(commandSpecs) {}
+
+        /**Execute
+        * this functions takes in a CustomerList and InventoryList
+        * and displays every customer whose name starts with the
+        * prefix in any case
+        * Preconditions: CustomerList and InventoryList must be initialized
+        * Postconditions: the customers are displayed in alphabetical
+        * order, if there is no prefix an error message is displayed
+        */
+        void Execute(CustomerList* cList, Inventory* iList);
+
+    };
+
+    /* AddCustomer is a type of Command that will add a new
+     * customer to the store while commands are running
+     */
+    class AddCustomer : public Command {
+
+    public:
+
+        /**
+      * @brief Construct a new AddCustomer object
+      * takes in a string that represents command
+      * @param commandSpecs : sets this to command member variables
+      */
+        AddCustomer(string commandSpecs) : Command(commandSpecs) {}
+
+        /**Execute
+        * this functions takes in a CustomerList and InventoryList
+        * and adds the customer with the ID and name of the command
+        * Preconditions: CustomerList and InventoryList must be initialized
+        * Postconditions: the customer can be used by the commands that
+        * follow, if the ID is taken an error message is displayed
+        */
+        void Execute(CustomerList* cList, Inventory* iList);
+
+    };
+
     /* CommandFactory creates the following commands based on the string that* is read in :
-    * Buy, Sell, Display, DisplayCustomers, and DisplayHistory
+    * Buy, Sell, Display, DisplayCustomers, DisplayHistory, LowStock,
+    * YearRange, ItemHistory, Report, TopSellers, NameSearch and AddCustomer
     *
     * Features :
     *-read in string
@@ -248,31 +497,66 @@ public:
      */
     ~CollectibleStore();
 
+    /**
+     * setLoadThreads
+     * this function sets the number of threads the inventory
+     * is loaded with
+     * Preconditions: none
+     * Postconditions: loadThreads is at least 1
+     * @param threads : number of threads
+     */
+    void setLoadThreads(int threads);
+
+    /**
+     * setQuarantineFile
+     * this function sets the file the inventory records that
+     * are not valid are copied to
+     * Preconditions: none
+     * Postconditions: bad records are written to path on the
+     * next load, an empty path turns this off
+     * @param path : file to write the bad records to
+     */
+    void setQuarantineFile(const string& path);
+
+    /**
+     * setCompaction
+     * this function sets when the journal is compacted, which
+     * transactions stay in memory and the file the rest are
+     * spilled to
+     * Preconditions: no commands have been run
+     * Postconditions: the journal is compacted as commands run
+     * @param policy : when to compact and what to keep
+     * @param path : file the transactions are spilled to
+     */
+    void setCompaction(const CompactionPolicy& policy, const string& path);
+
     /**
      * @brief initializeInventory
-     * reads in a file line by line and initializes collectible items
+     * splits a mapped file into records and initializes collectible items
      * and creates a hash table of items as well as a sorted list of
-     * items in the Inventory class
+     * items in the Inventory class. large files are split into chunks
+     * that are parsed and sorted on several threads
      * Preconditions: file must exist
      * Postconditions: Inventory is built
     */
-    void initializeInventory(ifstream& infile);
+    void initializeInventory(const InputSource& infile);
 
 
     /**
      * @brief initializeCustomers
-     * reads in a file line by line and initializes customers
+     * splits a mapped file into records and initializes customers
      * and creates a hash table of customers with their ID as the key
      *  as well as creates a sorted list of customers (alphabetical)
      * in the CustomerList class
      * Preconditions: file must exist
-     * Postconditions: CustomerList is built
+     * Postconditions: CustomerList is built, a customer whose ID is
+     * already used is reported and dropped
      */
-    void initializeCustomers(ifstream& infile);
+    void initializeCustomers(const InputSource& infile);
 
     /**
      * getCommands
-     * this function reads in commands from a file and
+     * this function splits a mapped file into commands and
      * initializes them via the CommandFactory and
      * stores them in the commands vector
      * Preconditions: file must be in the correct format
@@ -280,7 +564,7 @@ public:
      *
      * @param file : file of commands
     */
-    void getCommands(ifstream& infile);
+    void getCommands(const InputSource& infile);
 
 
 };
@@ -0,0 +1,206 @@
+#include "CollectibleStore.h"
+#include "TestCheck.h"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+/*
+ * @file CollectibleStoreTest.cpp
+ * @author Katarina McGaughy
+ * CollectibleStoreTest runs commands through a whole CollectibleStore
+ * and checks what they print.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -pthread CollectibleStoreTest.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o CollectibleStoreTest
+ * ./CollectibleStoreTest
+ *
+ * Features:
+ * -C with a page, a range of dates or both
+ * -bad dates and bad pages
+ * -customers whose ID is already used are dropped on load
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+static const string inventory =
+    "M, 10, 1913, 70, Liberty Nickel\n"
+    "M, 10, 2001, 65, Lincoln Cent\n"
+    "C, 10, 1938, Mint, Superman, DC\n";
+
+static const string customers =
+    "456, Donald Duck\n"
+    "123, Daisy Duck\n";
+
+//five transactions of Donald Duck, the C commands are added after them
+static const string sales =
+    "S, 456, M, 1913, 70, Liberty Nickel\n"
+    "S, 456, M, 2001, 65, Lincoln Cent\n"
+    "S, 456, C, 1938, Mint, Superman, DC\n"
+    "B, 456, M, 1913, 70, Liberty Nickel\n"
+    "S, 456, M, 1913, 70, Liberty Nickel\n";
+
+/**
+ * writeFile
+ * this function writes text to the file path
+ * @param path : file to write
+ * @param text : contents of the file
+ */
+static void writeFile(const char* path, const string& text) {
+    ofstream out(path, ios::binary);
+    out << text;
+}
+
+/**
+ * run
+ * this function loads inventory and customers into a new store and
+ * runs commands
+ * @param inventoryText : inventory records
+ * @param customerText : customer records
+ * @param commandText : commands
+ * @param loaded : set to what the load printed if not nullptr
+ * @return what the commands printed
+ */
+static string run(const string& inventoryText, const string& customerText,
+    const string& commandText, string* loaded = nullptr) {
+    writeFile("storetest_inventory.txt", inventoryText);
+    writeFile("storetest_customers.txt", customerText);
+    writeFile("storetest_commands.txt", commandText);
+    ostringstream printed;
+    streambuf* old = cout.rdbuf(printed.rdbuf());
+    {
+        CollectibleStore store;
+        InputSource inventoryFile("storetest_inventory.txt");
+        store.initializeInventory(inventoryFile);
+        InputSource customerFile("storetest_customers.txt");
+        store.initializeCustomers(customerFile);
+        cout << "Executing commands: " << endl;
+        InputSource commandFile("storetest_commands.txt");
+        store.getCommands(commandFile);
+    }
+    cout.rdbuf(old);
+    remove("storetest_inventory.txt");
+    remove("storetest_customers.txt");
+    remove("storetest_commands.txt");
+    string out = printed.str();
+    size_t start = out.find("Executing commands: \n");
+    if (loaded != nullptr) {
+        *loaded = out.substr(0, start);
+    }
+    return out.substr(start + 21);
+}
+
+/**
+ * testPages
+ * C shows the transactions of one page and says which they are
+ */
+static void testPages() {
+    string out = run(inventory, customers, sales + "C, 456, 1, 2\nC, 456, 10, 2\nC, 456, 0, 0\n");
+    CHECK(out ==
+        "(C) Displaying single customer: \n"
+        "456 Donald Duck transactions:\n"
+        "Bought from store:  Item: M, 2001, 65, Lincoln Cent (9 left in store)\n"
+        "Bought from store:  Item: C, 1938, Mint, Superman, DC (9 left in store)\n"
+        "Showing transactions 2 to 3 of 5\n"
+        "\n"
+        "(C) Displaying single customer: \n"
+        "456 Donald Duck transactions: none \n"
+        "Showing no transactions of 5\n"
+        "\n"
+        "(C) Displaying single customer: \n"
+        "456 Donald Duck transactions: none \n"
+        "Showing no transactions of 5\n"
+        "\n");
+}
+
+/**
+ * testDates
+ * C with a range of dates only shows the transactions made in it
+ * and can be paged within it, the transactions are made today
+ */
+static void testDates() {
+    string out = run(inventory, customers, sales +
+        "C, 456, 1990-01-01, 1990-12-31\n"
+        "C, 456, 2000-01-01, 2999-12-31, 3, 5\n");
+    CHECK(out ==
+        "(C) Displaying single customer from 1990-01-01 to 1990-12-31: \n"
+        "456 Donald Duck transactions: none \n"
+        "\n"
+        "(C) Displaying single customer from 2000-01-01 to 2999-12-31: \n"
+        "456 Donald Duck transactions:\n"
+        "Sold to store:  Item: M, 1913, 70, Liberty Nickel (9 left in store)\n"
+        "Bought from store:  Item: M, 1913, 70, Liberty Nickel (9 left in store)\n"
+        "Showing transactions 4 to 5 of 5\n"
+        "\n");
+
+    //the whole range is the same as no range
+    string all = run(inventory, customers, sales + "C, 456, 2000-01-01, 2999-12-31\n");
+    string none = run(inventory, customers, sales + "C, 456\n");
+    CHECK(all.substr(all.find('\n')) == none.substr(none.find('\n')));
+}
+
+/**
+ * testBadCommands
+ * bad dates and bad pages are reported and show nothing
+ */
+static void testBadCommands() {
+    string out = run(inventory, customers, sales +
+        "C, 456, 2022-02-30, 2999-12-31\n"
+        "C, 456, 2000-01-01\n"
+        "C, 456, 2000-01-01, 2999-12-31, 5\n"
+        "C, 456, -1, 2\n"
+        "C, 999\n");
+    CHECK(out ==
+        "Command: C, 456, 2022-02-30, 2999-12-31 has a bad date.Try again.\n"
+        "\n"
+        "Command: C, 456, 2000-01-01 has a bad date.Try again.\n"
+        "\n"
+        "Command: C, 456, 2000-01-01, 2999-12-31, 5 has a bad page.Try again.\n"
+        "\n"
+        "Command: C, 456, -1, 2 has a bad page.Try again.\n"
+        "\n"
+        "(C) Displaying single customer: \n"
+        "Customer: 999 could not be found.\n"
+        "\n");
+}
+
+/**
+ * testDuplicateCustomers
+ * a customer whose ID is already used is reported like A reports it
+ * and cannot be found by name or ID
+ */
+static void testDuplicateCustomers() {
+    string loaded;
+    string out = run(inventory, customers + "456, Scrooge McDuck\n",
+        "N, Scrooge\n"
+        "N, D\n"
+        "C, 456\n"
+        "A, 456, Scrooge McDuck\n", &loaded);
+    CHECK(loaded.find("Initializing customers: \n"
+        "Customer: 456 already exists.Try again.\n"
+        "123 Daisy Duck transactions: none \n"
+        "456 Donald Duck transactions: none \n") != string::npos);
+    CHECK(out ==
+        "(N) Displaying customers starting with: Scrooge\n"
+        " none \n"
+        "\n"
+        "(N) Displaying customers starting with: D\n"
+        "123 Daisy Duck\n"
+        "456 Donald Duck\n"
+        "\n"
+        "(C) Displaying single customer: \n"
+        "456 Donald Duck transactions: none \n"
+        "\n"
+        "Customer: 456 already exists.Try again.\n"
+        "\n");
+}
+
+int main() {
+    testPages();
+    testDates();
+    testBadCommands();
+    testDuplicateCustomers();
+    return TestCheck::report("CollectibleStoreTest");
+}
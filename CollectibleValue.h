@@ -0,0 +1,38 @@
+#pragma once
+/*
+ * @file CollectibleValue.h
+ * @author Katarina McGaughy
+ * CollectibleValue holds any one of the Collectible types by value so
+ * a whole inventory can be stored in one contiguous vector instead of
+ * one heap object per item. Code that knows it has a CollectibleValue
+ * finds the real type with the variant instead of a virtual call.
+ * The order of the types is the order the Inventory displays them and
+ * every type listed here is registered in the CollectibleRegistry.
+ *
+ * Features:
+ * -store a Coin, ComicBook or SportsCard by value
+ * -view the stored value as a Collectible
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <variant>
+#include "Coin.h"
+#include "ComicBook.h"
+#include "SportsCard.h"
+using namespace std;
+
+using CollectibleValue = variant<Coin, ComicBook, SportsCard>;
+
+/**
+ * asCollectible
+ * Preconditions: none
+ * Postconditions: returns the Collectible stored in value
+ * @param value : value holding a Collectible
+ */
+inline Collectible& asCollectible(CollectibleValue& value) {
+    return visit([](auto& col) -> Collectible& { return col; }, value);
+}
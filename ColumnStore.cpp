@@ -0,0 +1,178 @@
+#include "ColumnStore.h"
+#include <iostream>
+#include "FieldTokenizer.h"
+#include "SymbolTable.h"
+/*
+ * @file ColumnStore.cpp
+ * @author Katarina McGaughy
+ * ColumnStore keeps one type of Collectible as columns instead of
+ * objects. The counts, years, grades and interned names of every item
+ * are stored in their own contiguous arrays in sorted order, so scans
+ * such as displaying the inventory, low stock reports and year ranges
+ * read straight through memory. A ColumnRow holds the fields of one
+ * item when it is added.
+ *
+ * Features:
+ * -append a row
+ * -get and set the count of a row
+ * -display every row
+ * -display rows at or below a count
+ * -display rows in a range of years
+ *
+ * Assumptions:
+ * -rows are appended in sorted order
+ * -names are SymbolTable ids
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * @brief Construct a new ColumnStore object
+  * @param type : type of the Collectibles (M, C, S)
+  * @param named : true if grades are interned strings
+  * @param second : true if the second name is printed
+  */
+ColumnStore::ColumnStore(char type, bool named, bool second) :
+    tag(type), namedGrades(named), hasSecond(second) {}
+
+/**
+ * append
+ * this function adds a row to the end of the columns
+ * Preconditions: row must sort after the rows already added
+ * Postconditions: returns the index of the new row
+ * @param row : fields of the Collectible
+ */
+int ColumnStore::append(const ColumnRow& row) {
+    counts.push_back(row.count);
+    years.push_back(row.year);
+    grades.push_back(row.grade);
+    firsts.push_back(row.first);
+    seconds.push_back(row.second);
+    return static_cast<int>(counts.size()) - 1;
+}
+
+/**
+ * clear
+ * Preconditions: none
+ * Postconditions: the columns are empty
+ */
+void ColumnStore::clear() {
+    counts.clear();
+    years.clear();
+    grades.clear();
+    firsts.clear();
+    seconds.clear();
+}
+
+/**
+ * size
+ * Preconditions: none
+ * Postconditions: returns the number of rows
+ */
+int ColumnStore::size() const {
+    return static_cast<int>(counts.size());
+}
+
+/**
+ * getCount
+ * Preconditions: row must be less than size
+ * Postconditions: returns the count of row
+ * @param row : index of the row
+ */
+int ColumnStore::getCount(int row) const {
+    return counts[row];
+}
+
+/**
+ * setCount
+ * Preconditions: row must be less than size
+ * Postconditions: the count of row is count
+ * @param row : index of the row
+ * @param count : new count
+ */
+void ColumnStore::setCount(int row, int count) {
+    counts[row] = count;
+}
+
+/**
+ * appendRow
+ * this function appends the description of row to out in the
+ * same format Collectibles print themselves
+ * Preconditions: row must be less than size
+ * Postconditions: out ends with the row
+ * @param row : index of the row
+ * @param out : string the row is appended to
+ */
+void ColumnStore::appendRow(int row, string& out) const {
+    out.append(" Item: ").append(1, tag).append(", ");
+    FieldTokenizer::appendInt(out, years[row]);
+    out.append(", ");
+    if (namedGrades) {
+        out.append(SymbolTable::getName(grades[row]));
+    }
+    else {
+        FieldTokenizer::appendInt(out, static_cast<int>(grades[row]));
+    }
+    out.append(", ").append(SymbolTable::getName(firsts[row]));
+    if (hasSecond) {
+        out.append(", ").append(SymbolTable::getName(seconds[row]));
+    }
+    out.append(" (");
+    FieldTokenizer::appendInt(out, counts[row]);
+    out.append(" left in store)\n");
+}
+
+/**
+ * display
+ * this function prints every row in sorted order
+ * Preconditions: none
+ * Postconditions: the rows are printed
+ */
+void ColumnStore::display() const {
+    string out;
+    for (int row = 0; row < size(); row++) {
+        appendRow(row, out);
+    }
+    cout << out;
+}
+
+/**
+ * displayLowStock
+ * this function prints the rows whose count is at or
+ * below threshold in sorted order
+ * Preconditions: none
+ * Postconditions: the matching rows are printed
+ * @param threshold : largest count printed
+ */
+void ColumnStore::displayLowStock(int threshold) const {
+    string out;
+    for (int row = 0; row < size(); row++) {
+        if (counts[row] <= threshold) {
+            appendRow(row, out);
+        }
+    }
+    cout << out;
+}
+
+/**
+ * displayYears
+ * this function prints the rows whose year is from
+ * from to to in sorted order
+ * Preconditions: none
+ * Postconditions: the matching rows are printed
+ * @param from : first year printed
+ * @param to : last year printed
+ */
+void ColumnStore::displayYears(int from, int to) const {
+    string out;
+    for (int row = 0; row < size(); row++) {
+        if (years[row] >= from && years[row] <= to) {
+            appendRow(row, out);
+        }
+    }
+    cout << out;
+}
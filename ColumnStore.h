@@ -0,0 +1,147 @@
+#pragma once
+/*
+ * @file ColumnStore.h
+ * @author Katarina McGaughy
+ * ColumnStore keeps one type of Collectible as columns instead of
+ * objects. The counts, years, grades and interned names of every item
+ * are stored in their own contiguous arrays in sorted order, so scans
+ * such as displaying the inventory, low stock reports and year ranges
+ * read straight through memory. A ColumnRow holds the fields of one
+ * item when it is added.
+ *
+ * Features:
+ * -append a row
+ * -get and set the count of a row
+ * -display every row
+ * -display rows at or below a count
+ * -display rows in a range of years
+ *
+ * Assumptions:
+ * -rows are appended in sorted order
+ * -names are SymbolTable ids
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <string>
+#include <vector>
+#include <cstdint>
+using namespace std;
+
+/**
+ * ColumnRow struct holds the fields of one Collectible
+ */
+struct ColumnRow
+{
+    int count = 0;
+    int year = 0;
+    uint32_t grade = 0;     // grade of a coin, interned grade of the others
+    uint32_t first = 0;     // interned coin type, title or player
+    uint32_t second = 0;    // interned publisher or manufacturer
+};
+
+class ColumnStore
+{
+private:
+    char tag;               // type of the Collectibles (M, C, S)
+    bool namedGrades;       // true if grades are interned strings
+    bool hasSecond;         // true if the second name is printed
+    vector<int> counts;
+    vector<int> years;
+    vector<uint32_t> grades;
+    vector<uint32_t> firsts;
+    vector<uint32_t> seconds;
+
+    /**
+     * appendRow
+     * this function appends the description of row to out in the
+     * same format Collectibles print themselves
+     * Preconditions: row must be less than size
+     * Postconditions: out ends with the row
+     * @param row : index of the row
+     * @param out : string the row is appended to
+     */
+    void appendRow(int row, string& out) const;
+
+public:
+
+    /**
+     * @brief Construct a new ColumnStore object
+     * @param type : type of the Collectibles (M, C, S)
+     * @param named : true if grades are interned strings
+     * @param second : true if the second name is printed
+     */
+    ColumnStore(char type, bool named, bool second);
+
+    /**
+     * append
+     * this function adds a row to the end of the columns
+     * Preconditions: row must sort after the rows already added
+     * Postconditions: returns the index of the new row
+     * @param row : fields of the Collectible
+     */
+    int append(const ColumnRow& row);
+
+    /**
+     * clear
+     * Preconditions: none
+     * Postconditions: the columns are empty
+     */
+    void clear();
+
+    /**
+     * size
+     * Preconditions: none
+     * Postconditions: returns the number of rows
+     */
+    int size() const;
+
+    /**
+     * getCount
+     * Preconditions: row must be less than size
+     * Postconditions: returns the count of row
+     * @param row : index of the row
+     */
+    int getCount(int row) const;
+
+    /**
+     * setCount
+     * Preconditions: row must be less than size
+     * Postconditions: the count of row is count
+     * @param row : index of the row
+     * @param count : new count
+     */
+    void setCount(int row, int count);
+
+    /**
+     * display
+     * this function prints every row in sorted order
+     * Preconditions: none
+     * Postconditions: the rows are printed
+     */
+    void display() const;
+
+    /**
+     * displayLowStock
+     * this function prints the rows whose count is at or
+     * below threshold in sorted order
+     * Preconditions: none
+     * Postconditions: the matching rows are printed
+     * @param threshold : largest count printed
+     */
+    void displayLowStock(int threshold) const;
+
+    /**
+     * displayYears
+     * this function prints the rows whose year is from
+     * from to to in sorted order
+     * Preconditions: none
+     * Postconditions: the matching rows are printed
+     * @param from : first year printed
+     * @param to : last year printed
+     */
+    void displayYears(int from, int to) const;
+};
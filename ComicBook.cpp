@@ -33,12 +33,35 @@ ComicBook::ComicBook(const ComicBook& c) {
 	title = c.title;
 	count = c.count;
 	year = c.year;
-	key = c.key;
+	packed = c.packed;
+	fingerprint = c.fingerprint;
+	row = c.row;
+	id = c.id;
 	typeCol = c.typeCol;
 	grade = c.grade;
 
 }
 
+/**
+* @brief Construct a new ComicBook object
+* this function takes over the data of an instance of ComicBook
+* so a ComicBook can be moved without copying its strings
+* @param c : instance of ComicBook that is moved from
+*/
+ComicBook::ComicBook(ComicBook&& c) noexcept {
+	publisher = c.publisher;
+	title = c.title;
+	count = c.count;
+	year = c.year;
+	packed = c.packed;
+	fingerprint = c.fingerprint;
+	row = c.row;
+	id = c.id;
+	typeCol = move(c.typeCol);
+	grade = c.grade;
+
+}
+
 
 /**
  * @brief Construct a new ComicBook object
@@ -46,30 +69,62 @@ ComicBook::ComicBook(const ComicBook& c) {
  * of ComicBook based on the string
  * @param desc : whole description of the ComicBook
  */
-ComicBook::ComicBook(string desc)
+ComicBook::ComicBook(string_view desc)
 {
-	//C, 1, 1938, Mint, Superman, DC 
-	vector<string> v;
-	stringstream ss(desc);
-
-	while (ss.good()) {
-		string substr;
-		getline(ss, substr, ',');
-		v.push_back(substr);
-	}
+	FieldTokenizer fields(desc);
+	parse(fields);
+}
+
+/**
+ * @brief Construct a new ComicBook object
+ * this function sets the data members of ComicBook from the
+ * fields of a description that is already being split
+ * @param fields : tokenizer positioned at the first field
+ */
+ComicBook::ComicBook(FieldTokenizer& fields)
+{
+	parse(fields);
+}
 
-	typeCol = v[0];
-	count = stoi(v[1]);
-	year = stoi(v[2]);
-	grade = v[3];
-	title = v[4];
-	publisher = v[5];
-	grade.erase(grade.begin());
-	title.erase(title.begin());
-	publisher.erase(publisher.begin());
+/**
+* parse
+* this function sets the data members of ComicBook from
+* the fields of its description and checks that every
+* field is there and every number is valid
+* @param fields : tokenizer positioned at the first field
+* @return ParseError::None if the record is valid
+*/
+ParseError ComicBook::parse(FieldTokenizer& fields)
+{
+	//C, 1, 1938, Mint, Superman, DC
+	string_view typeField;
+	string_view gradeField;
+	string_view titleField;
+	string_view publisherField;
+	ParseError error = ParseError::None;
+	if ((error = fields.nextText(typeField)) != ParseError::None ||
+		(error = fields.nextInt(count)) != ParseError::None ||
+		(error = fields.nextInt(year)) != ParseError::None ||
+		(error = fields.nextText(gradeField)) != ParseError::None ||
+		(error = fields.nextText(titleField)) != ParseError::None ||
+		(error = fields.nextText(publisherField)) != ParseError::None) {
+		return error;
+	}
+	typeCol = typeField;
+	grade = SymbolTable::intern(gradeField);
+	title = SymbolTable::intern(titleField);
+	publisher = SymbolTable::intern(publisherField);
 
-	key = typeCol + ", " + to_string(year) +
-		", " + grade + ", " + title + ", " + publisher;
+	packed.tag = tag;
+	packed.prefix = PackedKey::makePrefix(publisherField);
+	packed.high = PackedKey::pack(publisher, title);
+	packed.low = PackedKey::pack(PackedKey::bias(year), grade);
+	//the key is built in a reused buffer so nothing is allocated
+	static thread_local string keyBuffer;
+	keyBuffer.clear();
+	appendFields(keyBuffer, gradeField, titleField, publisherField);
+	fingerprint = Fingerprint::of(keyBuffer);
+	return ParseError::None;
 }
 
 /**
@@ -119,26 +174,21 @@ string ComicBook::getType() {
 bool ComicBook::operator<(const Comparable& colToCompare) const {
 	const ComicBook& cb = static_cast<const ComicBook&>(colToCompare);
 	//publisher, then by title, then by year, then by grade
-	if (this->publisher < cb.publisher) {
-		return true;
+	if (packed.prefix != cb.packed.prefix) {
+		return packed.prefix < cb.packed.prefix;
 	}
-	else if (this->publisher == cb.publisher) {
-		if (this->title < cb.title) {
-			return true;
-		}
-		else if (this->title == cb.title) {
-			if (this->year < cb.year) {
-				return true;
-			}
-			else if (this->year == cb.year) {
-				if (this->grade < cb.grade) {
-					return true;
-				}
-			}
-		}
+	//names that share the prefix are compared as strings, ids are
+	//in the order the names were read
+	if (this->publisher != cb.publisher) {
+		return SymbolTable::getName(this->publisher) < SymbolTable::getName(cb.publisher);
 	}
-
-	return false;
+	if (this->title != cb.title) {
+		return SymbolTable::getName(this->title) < SymbolTable::getName(cb.title);
+	}
+	if (this->year != cb.year) {
+		return this->year < cb.year;
+	}
+	return SymbolTable::getName(this->grade) < SymbolTable::getName(cb.grade);
 }
 
 /**
@@ -165,10 +215,7 @@ bool ComicBook::operator>(const Comparable& rhs) const {
 */
 bool ComicBook::operator==(const Comparable& colToCompare) const {
 	const ComicBook& cb = static_cast<const ComicBook&>(colToCompare);
-	if (key == cb.key) {
-		return true;
-	}
-	return false;
+	return packed == cb.packed;
 }
 
 
@@ -194,14 +241,73 @@ Comparable* ComicBook::copy(const Comparable& c) {
 	return ptr;
 }
 
+/**
+* appendKey
+* this function appends the key of the Collectible to key
+* @param key : string the key is appended to
+*/
+void ComicBook::appendKey(string& key) const {
+	appendFields(key, SymbolTable::getName(grade), SymbolTable::getName(title),
+		SymbolTable::getName(publisher));
+}
+
+/**
+* appendFields
+* this function appends the key of the ComicBook to key with the
+* given names, parse passes the fields it read so it does not
+* look the names up in the SymbolTable
+* @param key : string the key is appended to
+* @param gradeName : name of the grade
+* @param titleName : title of the comic
+* @param publisherName : name of the publisher
+*/
+void ComicBook::appendFields(string& key, string_view gradeName, string_view titleName,
+	string_view publisherName) const {
+	key.reserve(key.size() + typeCol.size() + gradeName.size() + titleName.size() +
+		publisherName.size() + 16);
+	key.append(typeCol).append(", ");
+	FieldTokenizer::appendInt(key, year);
+	key.append(", ").append(gradeName).append(", ").append(titleName);
+	key.append(", ").append(publisherName);
+}
+
 /**getKey
 * this function returns key for Collectible
 */
 string ComicBook::getKey() const {
+	string key;
+	appendKey(key);
 	return key;
 }
 
 
+/**
+* hashCode
+* this function returns a hash of the fields and the count
+* of the ComicBook in inventory
+*/
+size_t ComicBook::hashCode() const {
+	size_t h = (static_cast<size_t>(publisher) << 40) ^
+		(static_cast<size_t>(title) << 16) ^ (static_cast<size_t>(grade) << 12) ^
+		static_cast<size_t>(year);
+	return hash<size_t>()(h) ^ (static_cast<size_t>(count) * 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+* getColumns
+* this function returns the fields of the ComicBook
+* as they are stored in a ColumnStore
+*/
+ColumnRow ComicBook::getColumns() const {
+	ColumnRow columns;
+	columns.count = count;
+	columns.year = year;
+	columns.grade = grade;
+	columns.first = title;
+	columns.second = publisher;
+	return columns;
+}
+
 /**
  * printCollectible
  * this function prints the description
@@ -210,5 +316,5 @@ string ComicBook::getKey() const {
 void ComicBook::print() const
 {
 	cout << " Item: ";
-	cout << key << " (" << count << " left in store)" << endl;
+	cout << getKey() << " (" << count << " left in store)" << endl;
 }
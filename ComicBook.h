@@ -21,6 +21,9 @@
  */
 
 #include "Collectible.h"
+#include "FieldTokenizer.h"
+#include "ParseResult.h"
+#include "SymbolTable.h"
 
 class ComicBook : public Collectible
 {
@@ -29,15 +32,41 @@ private:
 
 	string typeCol = "";
 	int count = 0;
-	string publisher = "";
-	string title = "";
+	uint32_t publisher = 0; // interned publisher
+	uint32_t title = 0; // interned title
 	int year = 0;
-	string grade = "";
-	string key = "";
-
+	uint32_t grade = 0; // interned grade
 
+	/**
+	* appendFields
+	* this function appends the key of the ComicBook to key with the
+	* given names, parse passes the fields it read so it does not
+	* look the names up in the SymbolTable
+	* @param key : string the key is appended to
+	* @param gradeName : name of the grade
+	* @param titleName : title of the comic
+	* @param publisherName : name of the publisher
+	*/
+	void appendFields(string& key, string_view gradeName, string_view titleName,
+		string_view publisherName) const;
 
 public:
+	//registry entry: first character of a comic book record and how
+	//a ColumnStore prints it
+	static constexpr char tag = 'C';
+	static constexpr bool namedGrades = true;
+	static constexpr bool hasSecond = true;
+
+	/**
+	* parse
+	* this function sets the data members of ComicBook from
+	* the fields of its description and checks that every
+	* field is there and every number is valid
+	* @param fields : tokenizer positioned at the first field
+	* @return ParseError::None if the record is valid
+	*/
+	ParseError parse(FieldTokenizer& fields);
+
 	/**
 	 * @brief Construct a new Comic Book object
 	 *
@@ -52,13 +81,39 @@ public:
 	 */
 	ComicBook(const ComicBook& c);
 
+	/**
+	 * @brief Construct a new ComicBook object
+	 * this function takes over the data of an instance of ComicBook
+	 * so a ComicBook can be moved without copying its strings
+	 * @param c : instance of ComicBook that is moved from
+	 */
+	ComicBook(ComicBook&& c) noexcept;
+
+	/**
+	 * operator=
+	 * this function copies or moves the data members of c
+	 * into this ComicBook
+	 * @param c : instance of ComicBook
+	 * @return ComicBook& : this ComicBook
+	 */
+	ComicBook& operator=(const ComicBook& c) = default;
+	ComicBook& operator=(ComicBook&& c) = default;
+
 	/**
 	 * @brief Construct a new ComicBook object
 	 * this function takes in a string and sets the data members
 	 * of ComicBook based on the string
 	 * @param desc : whole description of the ComicBook
 	 */
-	ComicBook(string desc);
+	ComicBook(string_view desc);
+
+	/**
+	 * @brief Construct a new ComicBook object
+	 * this function sets the data members of ComicBook from the
+	 * fields of a description that is already being split
+	 * @param fields : tokenizer positioned at the first field
+	 */
+	ComicBook(FieldTokenizer& fields);
 
 	/**
 	 * @brief Destroy the Comic Book object
@@ -144,11 +199,32 @@ public:
 	*/
 	Comparable* copy(const Comparable& c) override;
 
+	/**
+	* appendKey
+	* this function appends the key of the Collectible to key
+	* @param key : string the key is appended to
+	*/
+	void appendKey(string& key) const override;
+
 	/**getKey
 	* this function returns key for Collectible
 	*/
 	string getKey() const override;
 
+	/**
+	* hashCode
+	* this function returns a hash of the key and the count
+	* of the ComicBook in inventory
+	*/
+	size_t hashCode() const override;
+
+	/**
+	* getColumns
+	* this function returns the fields of the ComicBook
+	* as they are stored in a ColumnStore
+	*/
+	ColumnRow getColumns() const override;
+
 	/**
 	 * printCollectible
 	 * this function prints the description
@@ -45,7 +45,7 @@ class Comparable : public Object {
 
 	friend istream& operator>>(istream& in, Comparable& character);
 
-	/**
+	*
 	* Overloaded output operator for Comparable class
 	* Preconditions: Comparable object character must be initialized
 	* Postconditions: the storedChar is sent to the output stream
@@ -104,6 +104,24 @@ public:
 	*/
 	virtual bool operator<(const Comparable& rhs) const = 0;
 
+	/**
+	* compare
+	* this function orders the current object against the rhs object
+	* with one call, subclasses that can compare their fields once
+	* override it
+	* Precondition: there is another Comparable object that is initialized
+	* Postcondition: returns less than 0, 0 or greater than 0 if the
+	* current object is before, equal to or after rhs
+	* @param rhs: Comparable to be compared to current object
+	* @return: sign of the order of the two objects
+	*/
+	virtual int compare(const Comparable& rhs) const {
+		if (*this < rhs) {
+			return -1;
+		}
+		return (rhs < *this) ? 1 : 0;
+	}
+
 	/**
 	* Overloaded assignment operator for Comparable class
 	* Preconditions: none
@@ -127,5 +145,15 @@ public:
 	*/
 	virtual Comparable* copy(const Comparable& c) = 0;
 
+	/**
+	* hashCode
+	* this function returns a hash of the Comparable's contents, two
+	* Comparables that are equal and hold the same data return the same hash
+	* Precondition: none
+	* Postcondition: returns the hash
+	* @return: hash of the Comparable
+	*/
+	virtual size_t hashCode() const = 0;
+
 
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Customer.h"
+#include <algorithm>
 /*
  * @file Customer.h
  * @author Katarina McGaughy
@@ -9,6 +10,11 @@
  * Features:
  * - create a transaction (Buy or Sell)
  * - display all customers transactions
+ * - look up how many of a Collectible the customer holds
+ * - keep running totals of their transactions
+ * - render a page of transactions into a buffer
+ * - spill older transactions to the history file
+ * - dense ID the indexes and the transaction history use
  *
  *
  * @version 0.1
@@ -23,26 +29,39 @@
   * @brief Construct a new Customer object
   * creates a new customer with name and customerID
   *
-  * @param n : name of customer
-  * @param ID : customer ID
+  * @param n : customer ID and name of customer
   */
-Customer::Customer(string n)  {
+Customer::Customer(string_view n)  {
+    FieldTokenizer fields(n);
+    parse(fields);
+}
 
-    //fill in customer data 
-    vector<string> v;
-    stringstream ss(n);
+/**
+ * @brief Construct a new Customer object
+ * creates a new customer from the fields of a
+ * description that is already being split
+ *
+ * @param fields : tokenizer positioned at the customer ID
+ */
+Customer::Customer(FieldTokenizer& fields) {
+    parse(fields);
+}
 
-    while (ss.good()) {
-        string substr;
-        getline(ss, substr, ',');
-        v.push_back(substr);
+/**
+* parse
+* this function sets the data members of Customer from
+* the fields of its description
+* @param fields : tokenizer positioned at the first field
+*/
+void Customer::parse(FieldTokenizer& fields) {
+    //fill in customer data 
+    string_view field;
+    if (fields.next(field)) {
+        customerID = field;
+    }
+    if (fields.next(field)) {
+        name = field;
     }
-
-    
-    customerID = v[0];
-    name = v[1];
-    name.erase(name.begin());
-
 }
 
 /**
@@ -54,10 +73,26 @@ Customer::Customer(string n)  {
 Customer::Customer(const Customer& c) {
     name = c.name;
     customerID = c.customerID;
-    clearTransactions();
-    for (int i = 0; i < c.transactionHistory.size(); i++) {
-        transactionHistory.push_back(c.transactionHistory[i]);
-    }
+    id = c.id;
+    transactionHistory = c.transactionHistory;
+    journal = c.journal;
+    totals = c.totals;
+    holdings = c.holdings;
+}
+
+/**
+ * @brief Construct a new Customer object
+ * takes over the name, ID and transactions of Customer c,
+ * c is left with no transactions
+ *
+ * @param c : instance of customer that is moved from
+ */
+Customer::Customer(Customer&& c) noexcept
+    : name(move(c.name)), customerID(move(c.customerID)), id(c.id),
+    transactionHistory(move(c.transactionHistory)), journal(c.journal),
+    totals(c.totals), holdings(move(c.holdings)) {
+    c.transactionHistory.clear();
+    c.holdings.clear();
 }
 
 /**
@@ -74,7 +109,7 @@ Customer::~Customer()
 * Preconditions: none
 * Postconditions: returns customer name
 */
-string Customer::getName() const {
+const string& Customer::getName() const {
     return name;
 }
 
@@ -83,10 +118,30 @@ string Customer::getName() const {
 * Preconditions: none 
 * Postconditions: returns customer ID
 */
-string Customer::getCustomerID() const {
+const string& Customer::getCustomerID() const {
     return customerID;
 }
 
+/**
+* getId
+* Preconditions: none
+* Postconditions: returns the ID of the customer in the
+* CustomerList, UINT32_MAX if it is not in one
+*/
+uint32_t Customer::getId() const {
+    return id;
+}
+
+/**
+* setId
+* Preconditions: none
+* Postconditions: the ID of the customer is i
+* @param i : ID in the CustomerList
+*/
+void Customer::setId(uint32_t i) {
+    id = i;
+}
+
 /**
  * displayCustomerTransactions
  * prints the vector of transactions that are updated by
@@ -94,36 +149,191 @@ string Customer::getCustomerID() const {
  */
 void Customer::displayCustomerTransactions() const
 {
-    cout << customerID << " " << name << " transactions:";
-    if (transactionHistory.empty()) {
-        cout << " none " << endl;
+    displayCustomerTransactions(INT64_MIN, INT64_MAX);
+}
+
+/**
+ * displayCustomerTransactions
+ * prints the transactions made from from to to, they are
+ * found by a binary search of the journal times
+ * @param from : first second of the range
+ * @param to : last second of the range
+ */
+void Customer::displayCustomerTransactions(int64_t from, int64_t to) const
+{
+    HistoryPage page;
+    page.from = from;
+    page.to = to;
+    displayCustomerTransactions(page);
+}
+
+/**
+ * displayCustomerTransactions
+ * prints the transactions picked by page, they are rendered
+ * into a buffer displayChunk at a time so the output is not
+ * flushed per line
+ * @param page : range, offset and limit of the transactions
+ */
+void Customer::displayCustomerTransactions(const HistoryPage& page) const
+{
+    string buffer;
+    buffer.append(customerID).append(" ").append(name).append(" transactions:");
+    //a page with no limit only counts the range
+    HistoryPage chunk = page;
+    chunk.limit = 0;
+    size_t total = renderTransactions(buffer, chunk);
+    size_t first = min(page.offset, total);
+    size_t shown = min(page.limit, total - first);
+    if (shown == 0) {
+        buffer.append(" none \n");
     }
     else {
-        cout << endl;
-        for (int i = 0; i < transactionHistory.size(); i++)
-        {
-            transactionHistory[i]->printTransaction();
-        }
+        buffer.append("\n");
+    }
+    for (size_t done = 0; done < shown; done += chunk.limit) {
+        chunk.offset = first + done;
+        chunk.limit = min(displayChunk, shown - done);
+        renderTransactions(buffer, chunk);
+        cout << buffer;
+        buffer.clear();
+    }
+    if (page.isPaged() && shown == 0) {
+        buffer.append("Showing no transactions of ");
+        FieldTokenizer::appendInt(buffer, static_cast<int>(total));
+        buffer.append("\n");
+    }
+    else if (page.isPaged()) {
+        buffer.append("Showing transactions ");
+        FieldTokenizer::appendInt(buffer, static_cast<int>(first + 1));
+        buffer.append(" to ");
+        FieldTokenizer::appendInt(buffer, static_cast<int>(first + shown));
+        buffer.append(" of ");
+        FieldTokenizer::appendInt(buffer, static_cast<int>(total));
+        buffer.append("\n");
+    }
+    cout << buffer;
+}
+
+/**
+ * renderTransactions
+ * this function appends the lines of the transactions picked
+ * by page to out, nothing is printed. spilled transactions are
+ * older so they come first and are read back from the segment
+ * Preconditions: none
+ * Postconditions: the lines are appended to out, returns the
+ * number of transactions in the range of page
+ * @param out : string the lines are appended to
+ * @param page : range, offset and limit of the transactions
+ */
+size_t Customer::renderTransactions(string& out, const HistoryPage& page) const
+{
+    if (journal == nullptr) {
+        return 0;
+    }
+    size_t cold = 0;
+    const HistorySegment* segment = journal->getSegment();
+    if (segment != nullptr) {
+        cold = segment->render(id, *journal, page.from, page.to, page.offset,
+            page.limit, out);
+    }
+    size_t coldShown = cold > page.offset ? min(page.limit, cold - page.offset) : 0;
+    pair<size_t, size_t> range = journal->findTimeRange(transactionHistory,
+        page.from, page.to);
+    size_t total = range.second - range.first;
+    size_t skip = page.offset > cold ? page.offset - cold : 0;
+    size_t first = range.first + min(skip, total);
+    size_t last = first + min(page.limit - coldShown, range.second - first);
+    for (size_t i = first; i < last; i++) {
+        journal->getTransaction(transactionHistory[i]).appendTransaction(out);
+    }
+    return cold + total;
+}
+
+/**
+ * spillHistory
+ * this function spills the transactions that policy does not
+ * keep in memory to segment and marks their rows in spilled,
+ * they are still shown by displayCustomerTransactions
+ * Preconditions: spilled must have one entry per journal row
+ * Postconditions: returns the number of transactions spilled,
+ * remapHistory must be called once the journal drops the rows
+ * @param policy : which transactions stay in memory
+ * @param cutoff : transactions from this second on stay
+ * @param segment : file the transactions are spilled to
+ * @param spilled : set to true for each row that is spilled
+ */
+size_t Customer::spillHistory(const CompactionPolicy& policy, int64_t cutoff,
+    HistorySegment& segment, vector<bool>& spilled)
+{
+    if (journal == nullptr) {
+        return 0;
+    }
+    //everything before the newest keepLast and before cutoff goes
+    size_t count = transactionHistory.size() -
+        min(policy.keepLast, transactionHistory.size());
+    size_t recent = journal->findTimeRange(transactionHistory, cutoff, INT64_MAX).first;
+    count = min(count, recent);
+    if (count == 0 ||
+        !segment.spill(id, *journal, transactionHistory.data(), count)) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        spilled[transactionHistory[i]] = true;
+    }
+    transactionHistory.erase(transactionHistory.begin(),
+        transactionHistory.begin() + count);
+    transactionHistory.shrink_to_fit();
+    return count;
+}
+
+/**
+ * remapHistory
+ * this function moves the rows of the transactions to where the
+ * journal moved them
+ * Preconditions: no row of the customer was dropped
+ * Postconditions: the rows point to the same transactions
+ * @param moved : new row of every old row of the journal
+ */
+void Customer::remapHistory(const vector<uint32_t>& moved)
+{
+    for (size_t i = 0; i < transactionHistory.size(); i++) {
+        transactionHistory[i] = moved[transactionHistory[i]];
     }
 }
 
 /**
  * operator< overload
- * sorts customers in alphabetical order for the priority queue
+ * sorts customers in alphabetical order, customers with the
+ * same name are sorted by customer ID
  *
  * Preconditons: another customer object must be initialized
  * Postconditons: true will be returned if current Customer
- * is earlier in the alphabet than cust
+ * comes before cust
  * @param cust : customer to be compared to
  * @return true : if cust is larger
  * @return false : if cust is smaller
  */
 bool Customer::operator<(const Comparable& cust) const {
-    const Customer& c = static_cast<const Customer&>(cust);
-    if (this->name < c.name) {
-        return true;
+    return compare(cust) < 0;
+}
+
+/**
+* compare
+* this function orders customers by name and then by customer ID,
+* so two different customers are never equal
+* Precondition: there is another Customer object that is initialized
+* Postcondition: returns less than 0, 0 or greater than 0 if the
+* current customer is before, equal to or after rhs
+* @param rhs: Customer to be compared to current object
+* @return: sign of the order of the two customers
+*/
+int Customer::compare(const Comparable& rhs) const {
+    const Customer& c = static_cast<const Customer&>(rhs);
+    int order = name.compare(c.name);
+    if (order == 0) {
+        order = customerID.compare(c.customerID);
     }
-    return false;
+    return order;
 }
 
 /**
@@ -136,7 +346,7 @@ bool Customer::operator<(const Comparable& cust) const {
 * @return: true if the current Comparable objects is greater
 */
 bool Customer::operator>(const Comparable& rhs) const {
-    return !operator<(rhs);
+    return compare(rhs) > 0;
 }
 
 /**
@@ -149,11 +359,7 @@ bool Customer::operator>(const Comparable& rhs) const {
 *
 */
 bool Customer::operator==(const Comparable& colToCompare) const {
-    const Customer& c = static_cast<const Customer&>(colToCompare);
-    if ((this->name == c.name) && (this->customerID == c.customerID)) {
-        return true;
-    }
-    return false;
+    return compare(colToCompare) == 0;
 }
 
 /**
@@ -177,6 +383,14 @@ Comparable* Customer::copy(const Comparable& c) {
     return new Customer(cust);
 }
 
+/**
+* hashCode
+* this function returns a hash of the customer ID and name
+*/
+size_t Customer::hashCode() const {
+    return hash<string>()(customerID) ^ (hash<string>()(name) * 31);
+}
+
 /**
 * clearTransactions
 * this function clears all transcations
@@ -184,20 +398,17 @@ Comparable* Customer::copy(const Comparable& c) {
 * Postcondiitons: Transactions is empty 
 */
 void Customer::clearTransactions() {
-    for (int i = 0; i < transactionHistory.size(); i++) {
-        if (transactionHistory[i] != nullptr) {
-            delete transactionHistory[i];
-            transactionHistory[i] = nullptr;
-        }
-    }
     transactionHistory.clear();
+    holdings.clear();
+    totals = TransactionTotals();
 }
 
 /**
  * purchaseItem
  * this function takes in a collectible item and decrements
  * inventory of item by one and creates a transaction that
- * is added to the transactionHistory vector
+ * is added to the journal, its row is added to transactionHistory
+ * Preconditions: setJournal must have been called
  *
  * @param item : Collectible item to be purchased
  * @return true : if the purchase was complete
@@ -205,32 +416,73 @@ void Customer::clearTransactions() {
  */
 void Customer::purchaseItem(Collectible* item)
 {
-    Transaction* t = new Transaction(item, 'B');
-    transactionHistory.push_back(t);
+    transactionHistory.push_back(journal->append(id, item->getId(), 'B'));
+    totals.add('B');
+    holdings[item->getId()]++;
 }
 
 /**
  * sellItem
  * this function takes in a collectible item and increments
  * inventory of item by one and creates a transaction that
- * is added to the transactionHistory vector
+ * is added to the journal, its row is added to transactionHistory
+ * Preconditions: setJournal must have been called
  *
  * @param item : Collectible item to be sold
  * @return true : if the purchase was complete
  * @return false : if the purchase was not complete
  */
 void Customer::sellItem(Collectible* item) {
-    if (custHasCollectible(item)) {
-        Transaction* t = new Transaction(item, 'S');
-        transactionHistory.push_back(t);
-        //increment the inventory count
+    auto held = holdings.find(item->getId());
+    if (held != holdings.end()) {
+        transactionHistory.push_back(journal->append(id, item->getId(), 'S'));
+        totals.add('S');
+        //only items still held are kept
+        if (--held->second == 0) {
+            holdings.erase(held);
+        }
     }
     else {
-        Transaction* t = new Transaction(item, 'F');
-        transactionHistory.push_back(t);
+        transactionHistory.push_back(journal->append(id, item->getId(), 'F'));
+        totals.add('F');
     }
 }
 
+/**
+* getTotals
+* Precondtions: none
+* Postcondiitons: returns the counts of the transactions of
+* the customer by type
+*/
+const TransactionTotals& Customer::getTotals() const {
+    return totals;
+}
+
+/**
+* displayTotals
+* this function prints the counts of the transactions of
+* the customer and how many items they hold
+* Precondtions: none
+* Postcondiitons: the counts are printed
+*/
+void Customer::displayTotals() const {
+    cout << customerID << " " << name << " bought " << totals.bought;
+    cout << ", sold " << totals.sold << ", failed " << totals.failed;
+    cout << ", holds " << totals.held() << endl;
+}
+
+/**
+* setJournal
+* this function sets the journal the transactions of the
+* customer are added to
+* Precondtions: none
+* Postcondiitons: new transactions are added to j
+* @param j : journal of the store
+*/
+void Customer::setJournal(TransactionJournal* j) {
+    journal = j;
+}
+
 /**
 * custHasCollectible
 * this function takes in a collectible pointer to item
@@ -238,13 +490,20 @@ void Customer::sellItem(Collectible* item) {
 * Precondtions: item must be initialized
 * Postcondiitons: returns true if customer has the item
 */
-bool Customer::custHasCollectible(Collectible* item) {
-    for (int i = 0; i < transactionHistory.size(); i++) {
-        if (*transactionHistory[i]->getItem() == *item) {
-            return true;
-        }
-    }
-    return false;
+bool Customer::custHasCollectible(const Collectible* item) const {
+    return holdings.count(item->getId()) > 0;
+}
+
+/**
+* getHoldingCount
+* this function returns how many of item the customer holds,
+* items bought from the store minus items sold back to it
+* Precondtions: item must be initialized
+* Postcondiitons: returns the number held, 0 if none
+*/
+int Customer::getHoldingCount(const Collectible* item) const {
+    auto held = holdings.find(item->getId());
+    return held == holdings.end() ? 0 : held->second;
 }
 
 /**
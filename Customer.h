@@ -9,6 +9,11 @@
  * Features:
  * - create a transaction (Buy or Sell)
  * - display all customers transactions
+ * - look up how many of a Collectible the customer holds
+ * - keep running totals of their transactions
+ * - render a page of transactions into a buffer
+ * - spill older transactions to the history file
+ * - dense ID the indexes and the transaction history use
  *
  *
  * @version 0.1
@@ -19,10 +24,34 @@
  */
 #include "Object.h"
 #include "Transaction.h"
+#include "TransactionJournal.h"
 #include "Collectible.h"
 //#include "Inventory.h"
 #include <vector>
+#include <unordered_map>
 #include "Comparable.h"
+#include "FieldTokenizer.h"
+
+/**
+ * HistoryPage struct picks the transactions of a customer to show,
+ * those made from from to to and then offset and limit within them
+ */
+struct HistoryPage
+{
+    int64_t from = INT64_MIN;   // first second of the range
+    int64_t to = INT64_MAX;     // last second of the range
+    size_t offset = 0;          // transactions of the range to skip
+    size_t limit = SIZE_MAX;    // most transactions to show
+
+    /**
+     * isPaged
+     * Preconditions: none
+     * Postconditions: returns true if offset or limit are set
+     */
+    bool isPaged() const {
+        return offset != 0 || limit != SIZE_MAX;
+    }
+};
 
 class Customer : public Comparable
 {
@@ -30,7 +59,20 @@ class Customer : public Comparable
 private:
     string name = "";
     string customerID = "";
-    vector<Transaction*> transactionHistory; // transactions ordered in chronological order
+    uint32_t id = UINT32_MAX; // ID in the CustomerList, UINT32_MAX if none
+    vector<uint32_t> transactionHistory; // rows of the journal in chronological order
+    TransactionJournal* journal = nullptr; // journal of the store the rows are in
+    TransactionTotals totals; // counts of the transactions of the customer
+    unordered_map<uint32_t, int> holdings; // ID of each Collectible held to how many are held
+    static constexpr size_t displayChunk = 1024; // transactions rendered per write
+
+    /**
+    * parse
+    * this function sets the data members of Customer from
+    * the fields of its description
+    * @param fields : tokenizer positioned at the first field
+    */
+    void parse(FieldTokenizer& fields);
 
 public:
     /**
@@ -43,10 +85,18 @@ public:
      * @brief Construct a new Customer object
      * creates a new customer with name and customerID
      *
-     * @param n : name of customer
-     * @param ID : customer ID
+     * @param n : customer ID and name of customer
+     */
+    Customer(string_view n);
+
+    /**
+     * @brief Construct a new Customer object
+     * creates a new customer from the fields of a
+     * description that is already being split
+     *
+     * @param fields : tokenizer positioned at the customer ID
      */
-    Customer(string n);
+    Customer(FieldTokenizer& fields);
 
     /**
      * @brief Construct a new Customer object
@@ -56,19 +106,44 @@ public:
      */
     Customer(const Customer& c);
 
+    /**
+     * @brief Construct a new Customer object
+     * takes over the name, ID and transactions of Customer c,
+     * c is left with no transactions
+     *
+     * @param c : instance of customer that is moved from
+     */
+    Customer(Customer&& c) noexcept;
+
     /**
     * getName
     * Preconditions: none
     * Postconditions: returns customer name
     */
-    string getName() const;
+    const string& getName() const;
 
     /**
     * getCustomerID
     * Preconditions: none
     * Postconditions: returns customer ID
     */
-    string getCustomerID() const;
+    const string& getCustomerID() const;
+
+    /**
+    * getId
+    * Preconditions: none
+    * Postconditions: returns the ID of the customer in the
+    * CustomerList, UINT32_MAX if it is not in one
+    */
+    uint32_t getId() const;
+
+    /**
+    * setId
+    * Preconditions: none
+    * Postconditions: the ID of the customer is i
+    * @param i : ID in the CustomerList
+    */
+    void setId(uint32_t i);
 
     /**
      * @brief Destroy the Customer object
@@ -83,19 +158,89 @@ public:
      */
     void displayCustomerTransactions() const;
 
+    /**
+     * displayCustomerTransactions
+     * prints the transactions made from from to to, they are
+     * found by a binary search of the journal times
+     * @param from : first second of the range
+     * @param to : last second of the range
+     */
+    void displayCustomerTransactions(int64_t from, int64_t to) const;
+
+    /**
+     * displayCustomerTransactions
+     * prints the transactions picked by page, they are rendered
+     * into a buffer displayChunk at a time so the output is not
+     * flushed per line
+     * @param page : range, offset and limit of the transactions
+     */
+    void displayCustomerTransactions(const HistoryPage& page) const;
+
+    /**
+     * renderTransactions
+     * this function appends the lines of the transactions picked
+     * by page to out, nothing is printed. spilled transactions are
+     * older so they come first and are read back from the segment
+     * Preconditions: none
+     * Postconditions: the lines are appended to out, returns the
+     * number of transactions in the range of page
+     * @param out : string the lines are appended to
+     * @param page : range, offset and limit of the transactions
+     */
+    size_t renderTransactions(string& out, const HistoryPage& page) const;
+
+    /**
+     * spillHistory
+     * this function spills the transactions that policy does not
+     * keep in memory to segment and marks their rows in spilled,
+     * they are still shown by displayCustomerTransactions
+     * Preconditions: spilled must have one entry per journal row
+     * Postconditions: returns the number of transactions spilled,
+     * remapHistory must be called once the journal drops the rows
+     * @param policy : which transactions stay in memory
+     * @param cutoff : transactions from this second on stay
+     * @param segment : file the transactions are spilled to
+     * @param spilled : set to true for each row that is spilled
+     */
+    size_t spillHistory(const CompactionPolicy& policy, int64_t cutoff,
+        HistorySegment& segment, vector<bool>& spilled);
+
+    /**
+     * remapHistory
+     * this function moves the rows of the transactions to where the
+     * journal moved them
+     * Preconditions: no row of the customer was dropped
+     * Postconditions: the rows point to the same transactions
+     * @param moved : new row of every old row of the journal
+     */
+    void remapHistory(const vector<uint32_t>& moved);
+
     /**
      * operator< overload
-     * sorts customers in alphabetical order for the priority queue
+     * sorts customers in alphabetical order, customers with the
+     * same name are sorted by customer ID
      *
      * Preconditons: another customer object must be initialized
      * Postconditons: true will be returned if current Customer
-     * is earlier in the alphabet than cust
+     * comes before cust
      * @param cust : customer to be compared to
      * @return true : if cust is larger
      * @return false : if cust is smaller
      */
     bool operator<(const Comparable& colToCompare) const override;
 
+    /**
+    * compare
+    * this function orders customers by name and then by customer ID,
+    * so two different customers are never equal
+    * Precondition: there is another Customer object that is initialized
+    * Postcondition: returns less than 0, 0 or greater than 0 if the
+    * current customer is before, equal to or after rhs
+    * @param rhs: Customer to be compared to current object
+    * @return: sign of the order of the two customers
+    */
+    int compare(const Comparable& rhs) const override;
+
     /**
     * operator>
     * this function returns true if the current object is greater than the
@@ -134,6 +279,12 @@ public:
     */
     Comparable* copy(const Comparable& c) override;
 
+    /**
+    * hashCode
+    * this function returns a hash of the customer ID and name
+    */
+    size_t hashCode() const override;
+
     /**
     * clearTransactions
     * this function clears all transcations
@@ -146,7 +297,8 @@ public:
      * purchaseItem
      * this function takes in a collectible item and decrements
      * inventory of item by one and creates a transaction that
-     * is added to the transactionHistory vector
+     * is added to the journal, its row is added to transactionHistory
+     * Preconditions: setJournal must have been called
      *
      * @param item : Collectible item to be purchased
      * @return true : if the purchase was complete
@@ -158,7 +310,8 @@ public:
      * sellItem
      * this function takes in a collectible item and increments
      * inventory of item by one and creates a transaction that
-     * is added to the transactionHistory vector
+     * is added to the journal, its row is added to transactionHistory
+     * Preconditions: setJournal must have been called
      *
      * @param item : Collectible item to be sold
      * @return true : if the purchase was complete
@@ -166,6 +319,33 @@ public:
      */
     void sellItem(Collectible* item);
 
+    /**
+    * getTotals
+    * Precondtions: none
+    * Postcondiitons: returns the counts of the transactions of
+    * the customer by type
+    */
+    const TransactionTotals& getTotals() const;
+
+    /**
+    * displayTotals
+    * this function prints the counts of the transactions of
+    * the customer and how many items they hold
+    * Precondtions: none
+    * Postcondiitons: the counts are printed
+    */
+    void displayTotals() const;
+
+    /**
+    * setJournal
+    * this function sets the journal the transactions of the
+    * customer are added to
+    * Precondtions: none
+    * Postcondiitons: new transactions are added to j
+    * @param j : journal of the store
+    */
+    void setJournal(TransactionJournal* j);
+
      /**
     * custHasCollectible
     * this function takes in a collectible pointer to item
@@ -173,7 +353,16 @@ public:
     * Precondtions: item must be initialized
     * Postcondiitons: returns true if customer has the item
     */
-    bool custHasCollectible(Collectible* item);
+    bool custHasCollectible(const Collectible* item) const;
+
+    /**
+    * getHoldingCount
+    * this function returns how many of item the customer holds,
+    * items bought from the store minus items sold back to it
+    * Precondtions: item must be initialized
+    * Postcondiitons: returns the number held, 0 if none
+    */
+    int getHoldingCount(const Collectible* item) const;
 
     /**
     * print
@@ -12,6 +12,10 @@
  * Features:
  * -display all Customers
  * -display a single Customer
+ * -find Customers by the start of their name
+ * -spill older transactions of every Customer to the history file
+ * -add a Customer without rebuilding the lists
+ * -dense ID for every Customer
  *
  * @version 0.1
  * @date 2022-2-21
@@ -22,28 +26,40 @@
 
  /**
   * buildSortedList
-  * this function takes in a vector of Customer pointers
-  * and creates a sorted vector that is stored in orderedCustomerList
-  *
-  * @param customers : vector of Customer pointers
+  * this function inserts every Customer in customers
+  * into orderedCustomerList
   */
-void CustomerList::buildSortedList(vector<Object*>& customers)
+void CustomerList::buildSortedList()
 {
 
-    for (int i = 0; i < customers.size(); i++) {
-        Comparable* cust = dynamic_cast<Comparable*>(customers[i]);
-        orderedCustomerList->insert(cust);
+    for (size_t i = 0; i < customers.size(); i++) {
+        orderedCustomerList->insert(customers[i].get());
     }
 
 }
 
 
+/**
+ * indexCustomer
+ * this function adds customer to the indexes that are kept
+ * up to date one customer at a time
+ * Preconditions: customer must be owned by customers
+ * Postconditions: customer can be found by the start of its name
+ * @param customer : customer to index
+ */
+void CustomerList::indexCustomer(Customer* customer) {
+    names.insert(customer);
+}
+
+
 /**
  * @brief Construct a new Customer List object
  *
  */
 CustomerList::CustomerList() {
     orderedCustomerList = new SearchTree();
+    //customers owns the Customers
+    orderedCustomerList->setOwnsData(false);
 }
 
 /**
@@ -51,27 +67,93 @@ CustomerList::CustomerList() {
  *
  */
 CustomerList::~CustomerList() {
+    delete orderedCustomerList;
     orderedCustomerList = nullptr;
 
 }
 
 /**
  * buildCustomerList
- * this function takes in a vector of Customer pointers
- * along with a vector of keys that are associated with th customers
- * and calls buildSortedList in order to have an ordered list of
- * customers and then also creates a HashTable for quick access
- * Preconditons: vectors must be initialized
+ * this function takes over the Customers in list and calls
+ * buildSortedList in order to have an ordered list of
+ * customers and then also creates a HashTable with the customer
+ * IDs as keys for quick access
+ * Preconditons: none
  * Postconditons: HashTable of customers is built along with
- * an ordered list of Customers
- * @param customer : vector of Customer pointers
- * @param keys : vector of int keys
+ * an ordered list of Customers, the CustomerList owns them.
+ * a customer whose ID is already used by one before it in list
+ * is dropped like addCustomer drops it
+ * @param list : Customers of the store
+ * @return the IDs of the customers that were dropped
  */
-void CustomerList::buildCustomerList(vector<Object*> customer, vector<string> keys)
+vector<string> CustomerList::buildCustomerList(vector<unique_ptr<Customer>>&& list)
 {
+    customers = move(list);
+    vector<string> keys;
+    keys.reserve(customers.size());
+    for (size_t i = 0; i < customers.size(); i++) {
+        keys.push_back(customers[i]->getCustomerID());
+    }
+    customerList.build(move(keys)); // create Hashtable of customer IDs
 
-    buildSortedList(customer);
-    customerList.build(customer, keys); // create Hashtable of customers
+    //the table keeps the first customer of a repeated ID, the others
+    //are dropped and the table is built again without them
+    vector<string> repeated;
+    size_t kept = 0;
+    for (size_t i = 0; i < customers.size(); i++) {
+        //the table holds the ID of customers[i] as a uint32_t
+        if (customerList.getId(customers[i]->getCustomerID()) != static_cast<uint32_t>(i)) {
+            repeated.push_back(customers[i]->getCustomerID());
+            continue;
+        }
+        customers[kept++] = move(customers[i]);
+    }
+    customers.resize(kept);
+    if (!repeated.empty()) {
+        keys.clear();
+        for (size_t i = 0; i < customers.size(); i++) {
+            keys.push_back(customers[i]->getCustomerID());
+        }
+        customerList.build(move(keys));
+    }
+
+    numCustomers = customers.size();
+    customerIds.clear();
+    customerIds.reserve(customers.size());
+    for (size_t i = 0; i < customers.size(); i++) {
+        customers[i]->setJournal(journal);
+        customers[i]->setId(customerIds.add(customers[i].get()));
+        indexCustomer(customers[i].get());
+    }
+    buildSortedList();
+    return repeated;
+}
+
+/**
+ * addCustomer
+ * this function takes over customer and adds it to the
+ * HashTable, the ordered list and the name index one insert at
+ * a time, nothing is rebuilt
+ * Preconditons: customer must not be nullptr
+ * Postconditons: returns false and drops customer if its ID is
+ * already used
+ * @param customer : new Customer of the store
+ * @return true : if customer was added
+ */
+bool CustomerList::addCustomer(unique_ptr<Customer> customer)
+{
+    Customer* added = customer.get();
+    uint32_t id = static_cast<uint32_t>(customerIds.size());
+    if (!customerList.insert(added->getCustomerID(), id)) {
+        return false;
+    }
+    added->setJournal(journal);
+    added->setId(customerIds.add(added));
+    customers.push_back(move(customer));
+    numCustomers++;
+    orderedCustomerList->insert(added);
+    indexCustomer(added);
+    return true;
 }
 
 /**
@@ -97,12 +179,40 @@ void CustomerList::displayCustomers() const {
  *
  * @param customerID
  */
-void CustomerList::displaySingleCustomer(string customerID) const {
+void CustomerList::displaySingleCustomer(const string& customerID) const {
+    displaySingleCustomer(customerID, INT64_MIN, INT64_MAX);
+}
+
+/**
+ * displaySingleCustomer
+ * this functions prints the transactions of the customer with
+ * customerID that were made from from to to
+ *
+ * @param customerID
+ * @param from : first second of the range
+ * @param to : last second of the range
+ */
+void CustomerList::displaySingleCustomer(const string& customerID, int64_t from, int64_t to) const {
+    HistoryPage page;
+    page.from = from;
+    page.to = to;
+    displaySingleCustomer(customerID, page);
+}
+
+/**
+ * displaySingleCustomer
+ * this functions prints the transactions of the customer with
+ * customerID that are picked by page
+ *
+ * @param customerID
+ * @param page : range, offset and limit of the transactions
+ */
+void CustomerList::displaySingleCustomer(const string& customerID, const HistoryPage& page) const {
     //need to cast
-    Object* printCust = customerList.getValue(customerID);
+    Object* printCust = customerIds.get(customerList.getId(customerID));
     if (printCust != nullptr) {
         const Customer* s = dynamic_cast<const Customer*>(printCust);
-        s->displayCustomerTransactions();
+        s->displayCustomerTransactions(page);
     } 
     else {
         cout << "Customer: " << customerID << " could not be found." << endl;
@@ -110,6 +220,91 @@ void CustomerList::displaySingleCustomer(string customerID) const {
 
 }
 
+/**
+ * displayNamePrefix
+ * this function displays the ID and name of every customer whose
+ * name starts with prefix in any case, in alphabetical order
+ * Preconditions: none
+ * Postconditions: the matching customers are displayed
+ * @param prefix : start of the name
+ */
+void CustomerList::displayNamePrefix(string_view prefix) const {
+    vector<Customer*> found = names.findPrefix(prefix);
+    if (found.empty()) {
+        cout << " none " << endl;
+        return;
+    }
+    for (size_t i = 0; i < found.size(); i++) {
+        cout << found[i]->getCustomerID() << " " << found[i]->getName() << endl;
+    }
+}
+
+/**
+ * compactHistory
+ * this function spills the transactions of every customer that
+ * policy does not keep in memory to the segment of the journal
+ * and drops them from the journal
+ * Preconditons: the journal must have a segment
+ * Postconditons: returns the number of transactions spilled
+ * @param policy : which transactions stay in memory
+ */
+size_t CustomerList::compactHistory(const CompactionPolicy& policy) {
+    if (journal == nullptr || journal->getSegment() == nullptr) {
+        return 0;
+    }
+    int64_t cutoff = INT64_MAX;
+    if (policy.keepDays >= 0) {
+        cutoff = journal->getLastTime() - static_cast<int64_t>(policy.keepDays) * 86400;
+    }
+    vector<bool> spilled(journal->size(), false);
+    size_t count = 0;
+    for (size_t i = 0; i < customers.size(); i++) {
+        count += customers[i]->spillHistory(policy, cutoff, *journal->getSegment(), spilled);
+    }
+    if (count == 0) {
+        return 0;
+    }
+    vector<uint32_t> moved = journal->removeRows(spilled);
+    for (size_t i = 0; i < customers.size(); i++) {
+        customers[i]->remapHistory(moved);
+    }
+    return count;
+}
+
+/**
+ * setJournal
+ * this function sets the journal every customer adds their
+ * transactions to
+ * Preconditons: none
+ * Postconditons: every customer uses j
+ * @param j : journal of the store
+ */
+void CustomerList::setJournal(TransactionJournal* j) {
+    journal = j;
+    for (size_t i = 0; i < customers.size(); i++) {
+        customers[i]->setJournal(journal);
+    }
+}
+
+/**
+ * getJournal
+ * Preconditons: none
+ * Postconditons: returns the journal of the customers
+ */
+TransactionJournal* CustomerList::getJournal() const {
+    return journal;
+}
+
+/**
+ * getIds
+ * Preconditons: none
+ * Postconditons: returns the table that finds a Customer by
+ * its ID
+ */
+const IdTable<Customer>& CustomerList::getIds() const {
+    return customerIds;
+}
+
 /**
  * getCustomer
  * this functions take in the customerID as key to
@@ -118,8 +313,8 @@ void CustomerList::displaySingleCustomer(string customerID) const {
  *
  * @param customerID
  */
-Object* CustomerList::getCustomer(string customerID) const {
-    Object* cust = customerList.getValue(customerID);
+Object* CustomerList::getCustomer(const string& customerID) const {
+    Object* cust = customerIds.get(customerList.getId(customerID));
     return cust;
 }
 
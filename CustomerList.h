@@ -12,6 +12,10 @@
  * Features:
  * -display all Customers
  * -display a single Customer
+ * -find Customers by the start of their name
+ * -spill older transactions of every Customer to the history file
+ * -add a Customer without rebuilding the lists
+ * -dense ID for every Customer
  *
  * @version 0.1
  * @date 2022-2-21
@@ -21,28 +25,43 @@
  */
 #include <vector>
 #include "HashTable.h"
+#include "IdTable.h"
 #include "Customer.h"
 #include "SearchTree.h"
+#include "NameTrie.h"
 #include <queue>
+#include <memory>
 
 class CustomerList
 {
 private:
     int numCustomers = 0;
+    vector<unique_ptr<Customer>> customers; // owns every Customer, the lists below only point to them
+    IdTable<Customer> customerIds; // Customer of each ID, the ID is its index in customers
+    TransactionJournal* journal = nullptr; // journal the customers add their transactions to
     SearchTree* orderedCustomerList = nullptr; // list of customers in alphabetical order (H)
+    NameTrie names; // customers by the start of their name in any case (N)
     // the above vector will get sorted order using a priorityqueue
 
     //not sure if this needs to be pointer yet...
-    HashTable customerList; // hashtable that takes in customer ID and stores pointer to customer which can be used for quick access to customers for updating transactions along with accessing a single customers transaction history (C), allows for quick access to customer info via customer ID for Buy and Sell
+    HashTable customerList; // hashtable that takes in customer ID and stores the ID of the customer in customerIds which can be used for quick access to customers for updating transactions along with accessing a single customers transaction history (C), allows for quick access to customer info via customer ID for Buy and Sell
 
     /**
      * buildSortedList
-     * this function takes in a vector of Customer pointers
-     * and creates a sorted vector that is stored in orderedCustomerList
-     *
-     * @param customers : vector of Customer pointers
+     * this function inserts every Customer in customers
+     * into orderedCustomerList
      */
-    void buildSortedList(vector<Object*>& customers);
+    void buildSortedList();
+
+    /**
+     * indexCustomer
+     * this function adds customer to the indexes that are kept
+     * up to date one customer at a time
+     * Preconditions: customer must be owned by customers
+     * Postconditions: customer can be found by the start of its name
+     * @param customer : customer to index
+     */
+    void indexCustomer(Customer* customer);
 
 public:
     /**
@@ -59,17 +78,32 @@ public:
 
     /**
      * buildCustomerList
-     * this function takes in a vector of Customer pointers
-     * along with a vector of keys that are associated with th customers
-     * and calls buildSortedList in order to have an ordered list of
-     * customers and then also creates a HashTable for quick access
-     * Preconditons: vectors must be initialized
+     * this function takes over the Customers in list and calls
+     * buildSortedList in order to have an ordered list of
+     * customers and then also creates a HashTable with the customer
+     * IDs as keys for quick access
+     * Preconditons: none
      * Postconditons: HashTable of customers is built along with
-     * an ordered list of Customers
-     * @param customer : vector of Customer pointers
-     * @param keys : vector of int keys
+     * an ordered list of Customers, the CustomerList owns them.
+     * a customer whose ID is already used by one before it in list
+     * is dropped like addCustomer drops it
+     * @param list : Customers of the store
+     * @return the IDs of the customers that were dropped
      */
-    void buildCustomerList(vector<Object*> customer, vector<string> keys);
+    vector<string> buildCustomerList(vector<unique_ptr<Customer>>&& list);
+
+    /**
+     * addCustomer
+     * this function takes over customer and adds it to the
+     * HashTable, the ordered list and the name index one insert at
+     * a time, nothing is rebuilt
+     * Preconditons: customer must not be nullptr
+     * Postconditons: returns false and drops customer if its ID is
+     * already used
+     * @param customer : new Customer of the store
+     * @return true : if customer was added
+     */
+    bool addCustomer(unique_ptr<Customer> customer);
 
     /**
      * displaCustomer
@@ -92,7 +126,74 @@ public:
      *
      * @param customerID
      */
-    void displaySingleCustomer(string customerID) const;
+    void displaySingleCustomer(const string& customerID) const;
+
+    /**
+     * displaySingleCustomer
+     * this functions prints the transactions of the customer with
+     * customerID that were made from from to to
+     *
+     * @param customerID
+     * @param from : first second of the range
+     * @param to : last second of the range
+     */
+    void displaySingleCustomer(const string& customerID, int64_t from, int64_t to) const;
+
+    /**
+     * displaySingleCustomer
+     * this functions prints the transactions of the customer with
+     * customerID that are picked by page
+     *
+     * @param customerID
+     * @param page : range, offset and limit of the transactions
+     */
+    void displaySingleCustomer(const string& customerID, const HistoryPage& page) const;
+
+    /**
+     * displayNamePrefix
+     * this function displays the ID and name of every customer whose
+     * name starts with prefix in any case, in alphabetical order
+     * Preconditions: none
+     * Postconditions: the matching customers are displayed
+     * @param prefix : start of the name
+     */
+    void displayNamePrefix(string_view prefix) const;
+
+    /**
+     * compactHistory
+     * this function spills the transactions of every customer that
+     * policy does not keep in memory to the segment of the journal
+     * and drops them from the journal
+     * Preconditons: the journal must have a segment
+     * Postconditons: returns the number of transactions spilled
+     * @param policy : which transactions stay in memory
+     */
+    size_t compactHistory(const CompactionPolicy& policy);
+
+    /**
+     * setJournal
+     * this function sets the journal every customer adds their
+     * transactions to
+     * Preconditons: none
+     * Postconditons: every customer uses j
+     * @param j : journal of the store
+     */
+    void setJournal(TransactionJournal* j);
+
+    /**
+     * getJournal
+     * Preconditons: none
+     * Postconditons: returns the journal of the customers
+     */
+    TransactionJournal* getJournal() const;
+
+    /**
+     * getIds
+     * Preconditons: none
+     * Postconditons: returns the table that finds a Customer by
+     * its ID
+     */
+    const IdTable<Customer>& getIds() const;
 
     /*
     getCustomer
@@ -102,7 +203,7 @@ public:
     Postconditions: Customer pointer is returned for customer
     that matches key
     */
-    Object* getCustomer(string customerID) const;
+    Object* getCustomer(const string& customerID) const;
 };
 
 
@@ -0,0 +1,90 @@
+#include "DelimiterScanner.h"
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+/*
+ * @file DelimiterScanner.cpp
+ * @author Katarina McGaughy
+ * DelimiterScanner finds every newline and comma in a block of text
+ * and stores their offsets in order. It compares 32 bytes at a time
+ * with AVX2 or 16 bytes at a time with SSE2 when the compiler targets
+ * them, and falls back to a byte at a time loop otherwise.
+ *
+ * Features:
+ * -find the field and line ends of a whole block at once
+ *
+ * Assumptions:
+ * -blocks are smaller than 4GB so offsets fit in 32 bits
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * addMatches
+  * this function appends base plus the position of every set bit
+  * in mask to delims, lowest bit first
+  * @param mask : one bit per byte that is a delimiter
+  * @param base : offset of the first byte of the mask
+  * @param delims : vector the offsets are appended to
+  */
+static inline void addMatches(uint32_t mask, uint32_t base, vector<uint32_t>& delims) {
+    while (mask != 0) {
+#if defined(_MSC_VER)
+        unsigned long bit;
+        _BitScanForward(&bit, mask);
+#else
+        uint32_t bit = __builtin_ctz(mask);
+#endif
+        delims.push_back(base + bit);
+        mask &= mask - 1;
+    }
+}
+
+/**
+ * scan
+ * this function appends the offset of every ',' and '\n' in
+ * data to delims in the order they appear
+ * Preconditions: len must be less than 4GB
+ * Postconditions: delims holds the offsets of the delimiters
+ * @param data : start of the block
+ * @param len : number of bytes in the block
+ * @param delims : vector the offsets are appended to
+ */
+void DelimiterScanner::scan(const char* data, size_t len, vector<uint32_t>& delims) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i commas = _mm256_set1_epi8(',');
+    const __m256i newlines = _mm256_set1_epi8('\n');
+    for (; i + 32 <= len; i += 32) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i found = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, commas),
+            _mm256_cmpeq_epi8(bytes, newlines));
+        addMatches(static_cast<uint32_t>(_mm256_movemask_epi8(found)),
+            static_cast<uint32_t>(i), delims);
+    }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    const __m128i commas16 = _mm_set1_epi8(',');
+    const __m128i newlines16 = _mm_set1_epi8('\n');
+    for (; i + 16 <= len; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i found = _mm_or_si128(_mm_cmpeq_epi8(bytes, commas16),
+            _mm_cmpeq_epi8(bytes, newlines16));
+        addMatches(static_cast<uint32_t>(_mm_movemask_epi8(found)),
+            static_cast<uint32_t>(i), delims);
+    }
+#endif
+    //portable loop for the tail or when there is no SIMD
+    for (; i < len; i++) {
+        if (data[i] == ',' || data[i] == '\n') {
+            delims.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
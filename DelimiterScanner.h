@@ -0,0 +1,42 @@
+#pragma once
+/*
+ * @file DelimiterScanner.h
+ * @author Katarina McGaughy
+ * DelimiterScanner finds every newline and comma in a block of text
+ * and stores their offsets in order. It compares 32 bytes at a time
+ * with AVX2 or 16 bytes at a time with SSE2 when the compiler targets
+ * them, and falls back to a byte at a time loop otherwise.
+ *
+ * Features:
+ * -find the field and line ends of a whole block at once
+ *
+ * Assumptions:
+ * -blocks are smaller than 4GB so offsets fit in 32 bits
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+using namespace std;
+
+class DelimiterScanner
+{
+public:
+
+    /**
+     * scan
+     * this function appends the offset of every ',' and '\n' in
+     * data to delims in the order they appear
+     * Preconditions: len must be less than 4GB
+     * Postconditions: delims holds the offsets of the delimiters
+     * @param data : start of the block
+     * @param len : number of bytes in the block
+     * @param delims : vector the offsets are appended to
+     */
+    static void scan(const char* data, size_t len, vector<uint32_t>& delims);
+};
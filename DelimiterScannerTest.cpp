@@ -0,0 +1,143 @@
+#include "DelimiterScanner.h"
+#include "BulkLoader.h"
+#include "TestCheck.h"
+#include <random>
+/*
+ * @file DelimiterScannerTest.cpp
+ * @author Katarina McGaughy
+ * DelimiterScannerTest checks that the SIMD loops of DelimiterScanner
+ * find the same delimiters as a byte at a time loop, and that
+ * BulkLoader splits records the same way at any block size.
+ *
+ * Build and run from the source directory, once more with -mavx2 to
+ * test the 32 byte loop:
+ * g++ -std=c++17 DelimiterScannerTest.cpp DelimiterScanner.cpp BulkLoader.cpp FieldTokenizer.cpp InputSource.cpp ParseResult.cpp -o DelimiterScannerTest
+ * ./DelimiterScannerTest
+ *
+ * Features:
+ * -every length and start offset around the 16 and 32 byte blocks
+ * -records split across blocks and a last record without a newline
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * scanSlow
+  * this function finds the delimiters one byte at a time
+  * @param data : start of the block
+  * @param len : number of bytes in the block
+  * @return the offsets of every ',' and '\n'
+  */
+static vector<uint32_t> scanSlow(const char* data, size_t len) {
+    vector<uint32_t> delims;
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] == ',' || data[i] == '\n') {
+            delims.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return delims;
+}
+
+/**
+ * testScan
+ * every length and start offset finds the same delimiters as the
+ * byte at a time loop, including bytes next to ',' and '\n'
+ */
+static void testScan() {
+    const char letters[] = { ',', '\n', 'a', ' ', '+', '-', '\r', '\t', '\0',
+        static_cast<char>(0xAC), static_cast<char>(0x8A) };
+    mt19937 random(2022);
+    string text(300, ' ');
+    for (size_t i = 0; i < text.size(); i++) {
+        text[i] = letters[random() % sizeof(letters)];
+    }
+    bool same = true;
+    for (size_t offset = 0; offset < 33; offset++) {
+        for (size_t len = 0; len + offset <= 160; len++) {
+            vector<uint32_t> delims;
+            DelimiterScanner::scan(text.data() + offset, len, delims);
+            if (delims != scanSlow(text.data() + offset, len)) {
+                same = false;
+                cout << "offset " << offset << " length " << len << endl;
+            }
+        }
+    }
+    CHECK(same);
+
+    //every byte a delimiter and no delimiters at all
+    string commas(100, ',');
+    vector<uint32_t> delims;
+    DelimiterScanner::scan(commas.data(), commas.size(), delims);
+    CHECK(delims.size() == 100 && delims.back() == 99);
+    string none(100, 'x');
+    delims.clear();
+    DelimiterScanner::scan(none.data(), none.size(), delims);
+    CHECK(delims.empty());
+
+    //offsets are appended after what the vector already holds
+    delims.assign(1, 7);
+    DelimiterScanner::scan("a,b", 3, delims);
+    CHECK(delims.size() == 2 && delims[0] == 7 && delims[1] == 1);
+}
+
+/**
+ * readAll
+ * this function splits text with a BulkLoader and joins the fields
+ * of every record with '|' and the records with '/'
+ * @param text : input to split
+ * @param size : number of bytes scanned at a time
+ * @return the joined records
+ */
+static string readAll(string_view text, size_t size) {
+    BulkLoader loader(text, size);
+    FieldTokenizer fields("");
+    string out;
+    string_view field;
+    while (loader.nextRecord(fields)) {
+        while (fields.next(field)) {
+            out.append(field);
+            out.append("|");
+        }
+        out.append("/");
+    }
+    return out;
+}
+
+/**
+ * testBulkLoader
+ * records split the same way at every block size, also when a
+ * record is longer than a block
+ */
+static void testBulkLoader() {
+    string text = "M, 3, 2001, 65, Lincoln Cent\n"
+        "C, 1, 1938, Mint, Superman, DC\n"
+        "\n"
+        "S, 2, 1989, Near Mint, Ken Griffey Jr, Upper Deck\n"
+        "H";
+    string expected = "M|3|2001|65|Lincoln Cent|/"
+        "C|1|1938|Mint|Superman|DC|/"
+        "|/"
+        "S|2|1989|Near Mint|Ken Griffey Jr|Upper Deck|/"
+        "H|/";
+    bool same = true;
+    for (size_t size = 1; size <= text.size() + 1; size++) {
+        if (readAll(text, size) != expected) {
+            same = false;
+            cout << "block size " << size << endl;
+        }
+    }
+    CHECK(same);
+    CHECK(readAll(text, 1 << 20) == expected);
+    CHECK(readAll("", 16).empty());
+    CHECK(readAll("a,b\n", 16) == "a|b|/");
+}
+
+int main() {
+    testScan();
+    testBulkLoader();
+    return TestCheck::report("DelimiterScannerTest");
+}
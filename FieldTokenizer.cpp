@@ -0,0 +1,184 @@
+#include "FieldTokenizer.h"
+#include <charconv>
+/*
+ * @file FieldTokenizer.cpp
+ * @author Katarina McGaughy
+ * FieldTokenizer splits a comma separated record into fields without
+ * allocating. Each field is a string_view into the original line with
+ * the leading spaces removed, and numbers are read with from_chars.
+ * It is shared by the Coin, ComicBook, SportsCard and Customer parsers.
+ * When the delimiters of the line were already found by the
+ * DelimiterScanner the tokenizer uses their offsets instead of searching.
+ *
+ * Features:
+ * -split a line into fields
+ * -use precomputed field ends
+ * -read int fields
+ * -read required fields without throwing
+ * -append int to a string
+ *
+ * Assumptions:
+ * -the line outlives the tokenizer and the fields it returns
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * @brief Construct a new FieldTokenizer object
+  * @param record : line to split
+  * @param delim : character between fields
+  */
+FieldTokenizer::FieldTokenizer(string_view record, char delim) :
+    line(record), delimiter(delim) {}
+
+/**
+ * @brief Construct a new FieldTokenizer object
+ * that uses field ends found by the DelimiterScanner
+ * @param record : line to split
+ * @param ends : offsets in the block of the commas in the line
+ * @param numEnds : number of offsets in ends
+ * @param lineOffset : offset of the line in the block
+ */
+FieldTokenizer::FieldTokenizer(string_view record, const uint32_t* ends,
+    size_t numEnds, size_t lineOffset) :
+    line(record), fieldEnds(ends), numFieldEnds(numEnds), base(lineOffset) {}
+
+/**
+ * getLine
+ * Preconditions: none
+ * Postconditions: returns the whole line being split
+ */
+string_view FieldTokenizer::getLine() const {
+    return line;
+}
+
+/**
+ * next
+ * this function sets field to the next field of the line
+ * with the leading spaces removed
+ * Preconditions: none
+ * Postconditions: returns false if there are no fields left
+ * @param field : set to the next field
+ * @return true : if a field was found
+ */
+bool FieldTokenizer::next(string_view& field) {
+    if (done) {
+        return false;
+    }
+    size_t end;
+    if (fieldEnds != nullptr) {
+        end = nextFieldEnd < numFieldEnds ?
+            fieldEnds[nextFieldEnd++] - base : string_view::npos;
+    }
+    else {
+        end = line.find(delimiter, pos);
+    }
+    if (end == string_view::npos) {
+        end = line.size();
+        done = true;
+    }
+    size_t start = pos;
+    while (start < end && line[start] == ' ') {
+        start++;
+    }
+    field = line.substr(start, end - start);
+    pos = end + 1;
+    return true;
+}
+
+/**
+ * nextText
+ * this function sets field to the next field of the line
+ * with the leading spaces removed
+ * Preconditions: none
+ * Postconditions: returns ParseError::MissingField if there are
+ * no fields left or the field is blank
+ * @param field : set to the next field
+ * @return ParseError::None if a field was found
+ */
+ParseError FieldTokenizer::nextText(string_view& field) {
+    if (!next(field)) {
+        return ParseError::MissingField;
+    }
+    size_t last = field.size();
+    while (last > 0 && (field[last - 1] == ' ' || field[last - 1] == '\r')) {
+        last--;
+    }
+    return last == 0 ? ParseError::MissingField : ParseError::None;
+}
+
+/**
+ * nextInt
+ * this function reads the next field of the line as an int
+ * Preconditions: none
+ * Postconditions: returns ParseError::MissingField if there are
+ * no fields left and ParseError::BadNumber if the field is not
+ * an int
+ * @param value : set to the int read
+ * @return ParseError::None if an int was read
+ */
+ParseError FieldTokenizer::nextInt(int& value) {
+    string_view field;
+    ParseError error = nextText(field);
+    if (error != ParseError::None) {
+        return error;
+    }
+    return toInt(field, value) ? ParseError::None : ParseError::BadNumber;
+}
+
+/**
+ * rest
+ * this function returns the remainder of the line from the
+ * next field on with the leading spaces removed
+ * Preconditions: none
+ * Postconditions: no fields are left
+ */
+string_view FieldTokenizer::rest() {
+    if (done) {
+        return string_view();
+    }
+    done = true;
+    size_t start = pos;
+    while (start < line.size() && line[start] == ' ') {
+        start++;
+    }
+    return start < line.size() ? line.substr(start) : string_view();
+}
+
+/**
+ * toInt
+ * this function reads an int from field
+ * Preconditions: none
+ * Postconditions: returns false if field is not an int
+ * @param field : field to read
+ * @param value : set to the int read
+ * @return true : if the whole field was an int
+ */
+bool FieldTokenizer::toInt(string_view field, int& value) {
+    const char* first = field.data();
+    const char* last = field.data() + field.size();
+    //allow trailing spaces like stoi did
+    while (last > first && (last[-1] == ' ' || last[-1] == '\r')) {
+        last--;
+    }
+    from_chars_result result = from_chars(first, last, value);
+    return result.ec == errc() && result.ptr == last && first != last;
+}
+
+/**
+ * appendInt
+ * this function appends value to out without a temporary string
+ * Preconditions: none
+ * Postconditions: value is appended to out
+ * @param out : string to append to
+ * @param value : int to append
+ */
+void FieldTokenizer::appendInt(string& out, int value) {
+    char buffer[16];
+    to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr - buffer);
+}
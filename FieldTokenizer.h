@@ -0,0 +1,137 @@
+#pragma once
+/*
+ * @file FieldTokenizer.h
+ * @author Katarina McGaughy
+ * FieldTokenizer splits a comma separated record into fields without
+ * allocating. Each field is a string_view into the original line with
+ * the leading spaces removed, and numbers are read with from_chars.
+ * It is shared by the Coin, ComicBook, SportsCard and Customer parsers.
+ * When the delimiters of the line were already found by the
+ * DelimiterScanner the tokenizer uses their offsets instead of searching.
+ *
+ * Features:
+ * -split a line into fields
+ * -use precomputed field ends
+ * -read int fields
+ * -read required fields without throwing
+ * -append int to a string
+ *
+ * Assumptions:
+ * -the line outlives the tokenizer and the fields it returns
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include "ParseResult.h"
+using namespace std;
+
+class FieldTokenizer
+{
+private:
+    string_view line;       // record being split
+    size_t pos = 0;         // start of the next field
+    bool done = false;      // true once the last field is returned
+    char delimiter = ',';
+    const uint32_t* fieldEnds = nullptr;   // precomputed delimiter offsets
+    size_t numFieldEnds = 0;
+    size_t nextFieldEnd = 0;
+    size_t base = 0;        // offset of the line in the scanned block
+
+public:
+
+    /**
+     * @brief Construct a new FieldTokenizer object
+     * @param record : line to split
+     * @param delim : character between fields
+     */
+    FieldTokenizer(string_view record, char delim = ',');
+
+    /**
+     * @brief Construct a new FieldTokenizer object
+     * that uses field ends found by the DelimiterScanner
+     * @param record : line to split
+     * @param ends : offsets in the block of the commas in the line
+     * @param numEnds : number of offsets in ends
+     * @param lineOffset : offset of the line in the block
+     */
+    FieldTokenizer(string_view record, const uint32_t* ends, size_t numEnds,
+        size_t lineOffset);
+
+    /**
+     * getLine
+     * Preconditions: none
+     * Postconditions: returns the whole line being split
+     */
+    string_view getLine() const;
+
+    /**
+     * next
+     * this function sets field to the next field of the line
+     * with the leading spaces removed
+     * Preconditions: none
+     * Postconditions: returns false if there are no fields left
+     * @param field : set to the next field
+     * @return true : if a field was found
+     */
+    bool next(string_view& field);
+
+    /**
+     * nextText
+     * this function sets field to the next field of the line
+     * with the leading spaces removed
+     * Preconditions: none
+     * Postconditions: returns ParseError::MissingField if there are
+     * no fields left or the field is blank
+     * @param field : set to the next field
+     * @return ParseError::None if a field was found
+     */
+    ParseError nextText(string_view& field);
+
+    /**
+     * nextInt
+     * this function reads the next field of the line as an int
+     * Preconditions: none
+     * Postconditions: returns ParseError::MissingField if there are
+     * no fields left and ParseError::BadNumber if the field is not
+     * an int
+     * @param value : set to the int read
+     * @return ParseError::None if an int was read
+     */
+    ParseError nextInt(int& value);
+
+    /**
+     * rest
+     * this function returns the remainder of the line from the
+     * next field on with the leading spaces removed
+     * Preconditions: none
+     * Postconditions: no fields are left
+     */
+    string_view rest();
+
+    /**
+     * toInt
+     * this function reads an int from field
+     * Preconditions: none
+     * Postconditions: returns false if field is not an int
+     * @param field : field to read
+     * @param value : set to the int read
+     * @return true : if the whole field was an int
+     */
+    static bool toInt(string_view field, int& value);
+
+    /**
+     * appendInt
+     * this function appends value to out without a temporary string
+     * Preconditions: none
+     * Postconditions: value is appended to out
+     * @param out : string to append to
+     * @param value : int to append
+     */
+    static void appendInt(string& out, int value);
+};
@@ -0,0 +1,130 @@
+#include "FieldTokenizer.h"
+#include "TestCheck.h"
+#include <climits>
+/*
+ * @file FieldTokenizerTest.cpp
+ * @author Katarina McGaughy
+ * FieldTokenizerTest checks how FieldTokenizer splits records into
+ * fields and reads and writes numbers.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 FieldTokenizerTest.cpp FieldTokenizer.cpp ParseResult.cpp -o FieldTokenizerTest
+ * ./FieldTokenizerTest
+ *
+ * Features:
+ * -split fields and strip leading spaces
+ * -empty fields and the rest of a record
+ * -read whole numbers and reject the rest
+ * -write numbers
+ * -missing fields and bad numbers
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * testFields
+  * fields are split at the delimiter and lose their leading spaces
+  */
+static void testFields() {
+    FieldTokenizer fields("M, 3,  2001,65, Lincoln Cent");
+    string_view field;
+    CHECK(fields.next(field) && field == "M");
+    CHECK(fields.next(field) && field == "3");
+    CHECK(fields.next(field) && field == "2001");
+    CHECK(fields.next(field) && field == "65");
+    CHECK(fields.next(field) && field == "Lincoln Cent");
+    CHECK(!fields.next(field));
+
+    FieldTokenizer empty("a,,b,");
+    CHECK(empty.next(field) && field == "a");
+    CHECK(empty.next(field) && field.empty());
+    CHECK(empty.next(field) && field == "b");
+    CHECK(empty.next(field) && field.empty());
+    CHECK(!empty.next(field));
+
+    FieldTokenizer other("456 Donald Duck", ' ');
+    CHECK(other.next(field) && field == "456");
+    CHECK(other.next(field) && field == "Donald");
+}
+
+/**
+ * testRest
+ * rest returns everything after the fields already read
+ */
+static void testRest() {
+    FieldTokenizer fields("S, 456, M, 1913, 70, Liberty Nickel");
+    string_view field;
+    fields.next(field);
+    fields.next(field);
+    CHECK(fields.rest() == "M, 1913, 70, Liberty Nickel");
+    CHECK(fields.rest().empty());
+    CHECK(!fields.next(field));
+
+    FieldTokenizer shortRecord("H");
+    shortRecord.next(field);
+    CHECK(shortRecord.rest().empty());
+}
+
+/**
+ * testToInt
+ * toInt reads whole numbers with trailing spaces and rejects the rest
+ */
+static void testToInt() {
+    int value = 0;
+    CHECK(FieldTokenizer::toInt("2001", value) && value == 2001);
+    CHECK(FieldTokenizer::toInt("-15", value) && value == -15);
+    CHECK(FieldTokenizer::toInt("70 \r", value) && value == 70);
+    CHECK(FieldTokenizer::toInt("2147483647", value) && value == INT_MAX);
+    CHECK(!FieldTokenizer::toInt("2147483648", value));
+    CHECK(!FieldTokenizer::toInt("", value));
+    CHECK(!FieldTokenizer::toInt(" ", value));
+    CHECK(!FieldTokenizer::toInt("12x", value));
+    CHECK(!FieldTokenizer::toInt("1 2", value));
+    CHECK(!FieldTokenizer::toInt("Mint", value));
+}
+
+/**
+ * testAppendInt
+ * appendInt writes the same digits as to_string
+ */
+static void testAppendInt() {
+    string out = "count ";
+    FieldTokenizer::appendInt(out, 0);
+    out.append(" ");
+    FieldTokenizer::appendInt(out, -42);
+    out.append(" ");
+    FieldTokenizer::appendInt(out, INT_MIN);
+    CHECK(out == "count 0 -42 " + to_string(INT_MIN));
+}
+
+/**
+ * testErrors
+ * nextText and nextInt tell a missing field from a bad number
+ */
+static void testErrors() {
+    FieldTokenizer fields("M, 3, x12, ,  \r");
+    string_view field;
+    int value = 0;
+    CHECK(fields.nextText(field) == ParseError::None && field == "M");
+    CHECK(fields.nextInt(value) == ParseError::None && value == 3);
+    CHECK(fields.nextInt(value) == ParseError::BadNumber);
+    CHECK(fields.nextText(field) == ParseError::MissingField);
+    CHECK(fields.nextInt(value) == ParseError::MissingField);
+    CHECK(fields.nextText(field) == ParseError::MissingField);
+
+    FieldTokenizer text("Lincoln Cent \r");
+    CHECK(text.nextText(field) == ParseError::None);
+}
+
+int main() {
+    testFields();
+    testRest();
+    testToInt();
+    testAppendInt();
+    testErrors();
+    return TestCheck::report("FieldTokenizerTest");
+}
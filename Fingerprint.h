@@ -0,0 +1,42 @@
+#pragma once
+/*
+ * @file Fingerprint.h
+ * @author Katarina McGaughy
+ * Fingerprint hashes the text of a key into 64 bits with FNV-1a.
+ * A Collectible computes the fingerprint of its key once when it is
+ * parsed, the HashTable places and probes with it and only compares
+ * whole keys when two fingerprints match.
+ *
+ * Features:
+ * -hash key text into 64 bits
+ *
+ * Assumptions:
+ * -equal keys have equal fingerprints, different keys almost never do
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <string_view>
+#include <cstdint>
+using namespace std;
+
+struct Fingerprint
+{
+    /**
+     * of
+     * Preconditions: none
+     * Postconditions: returns the 64 bit FNV-1a hash of key
+     * @param key : text to hash
+     */
+    static uint64_t of(string_view key) {
+        uint64_t h = 14695981039346656037ULL;
+        for (size_t i = 0; i < key.size(); i++) {
+            h ^= static_cast<unsigned char>(key[i]);
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+};
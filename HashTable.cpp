@@ -1,4 +1,5 @@
 #include "HashTable.h"
+#include <algorithm>
 
 //create a constructor for customer that takes in size (1000) and takes in string of customerID
 
@@ -6,12 +7,14 @@
  * @file HashTable.h
  * @author Katarina McGaughy
  * HashTable class creates a hash table of objects with strings as keys.
+ * It stores the dense ID of each object, the objects themselves are
+ * found by ID in an IdTable.
  *
  *
  * Features:
  * -insert
  * -remove
- * -getObject
+ * -getId
  * -clear
  * -isEmpty
  * -resizeArray
@@ -27,49 +30,101 @@
 
  /**
   * hash
-  * this function takes in a key and then returns
-  * an index where the Object will be inserted
-  * @param key : string representing the key
-  * @return int : index
+  * this function takes in the fingerprint of a key and then
+  * returns an index where the key will be inserted
+  * @param keyHash : Fingerprint of the key
+  * @return size_t : index
   */
-int HashTable::hash(string key) const
+size_t HashTable::hash(uint64_t keyHash) const
 {
-    int index = 0;
-    int in = 0;
-    for (int i = 0; i < key.length(); i++) {
-        in += key[i];
+    return static_cast<size_t>(keyHash % size);
+}
+
+/**
+ * findSlot
+ * this function probes from the hash of key and returns the index
+ * of the Item holding key, or of the first empty slot if no Item
+ * holds key, keys are only compared when the fingerprints match
+ * Preconditions: hashTable must have at least one empty slot
+ * Postconditions: returns the index of key or of an empty slot
+ * @param key : string representing the key
+ * @param keyHash : Fingerprint of key
+ * @return size_t : index
+ */
+size_t HashTable::findSlot(const string& key, uint64_t keyHash) const
+{
+    size_t index = hash(keyHash);
+    while (hashTable[index] >= 0 &&
+        (items[hashTable[index]].hash != keyHash || items[hashTable[index]].key != key)) {
+        index++;
+        if (index == size) {
+            index = 0;
+        }
     }
+    return index;
+}
 
-    index = (in % size);
 
-    if (index < 0) {
-        index += size;
+/**
+ * grow
+ * this function makes the table newSize slots and puts every
+ * Item back in its slot with the fingerprint it already has
+ * Preconditions: newSize must be more than twice numItems
+ * Postconditions: every key is found in the larger table
+ * @param newSize : number of slots
+ */
+void HashTable::grow(size_t newSize)
+{
+    size = newSize;
+    hashTable.assign(size, -1);
+    for (size_t i = 0; i < items.size(); i++) {
+        hashTable[findSlot(items[i].key, items[i].hash)] = static_cast<int>(i);
     }
+}
 
-    int i = 1;
-    while (hashTable[index] != nullptr) {
-        index = (in + i) % size;
-        i++;
+/**
+ * insert
+ * this function adds id under key, the table doubles when
+ * it would be more than half full so each insert is amortized O(1)
+ * Preconditions: none
+ * Postconditions: returns false and adds nothing if key is
+ * already in the table
+ * @param key : string representing the key
+ * @param id : ID of the object of key
+ * @return true : if id was added
+ */
+bool HashTable::insert(const string& key, uint32_t id)
+{
+    //keep at most half the slots full so probes stay short
+    if ((numItems + 1) * 2 >= size) {
+        grow(max(size * 2 + 1, (numItems + 1) * 2 + 1));
     }
-
-    return index;
-
+    uint64_t keyHash = Fingerprint::of(key);
+    size_t index = findSlot(key, keyHash);
+    if (hashTable[index] >= 0) {
+        return false;
+    }
+    Item item;
+    item.key = key;
+    item.hash = keyHash;
+    item.id = id;
+    hashTable[index] = static_cast<int>(items.size());
+    items.push_back(move(item));
+    numItems++;
+    return true;
 }
 
-
 /**
  * @brief Construct a new Hash Table object
- * Constructor takes in vector of Object pointers and auto keys
- * and creates a hashtable
- * if the number of elements in hashObjects is greater than 1/2
+ * Constructor takes in vector of keys and creates a hashtable
+ * where the ID of keys[i] is i
+ * if the number of keys is greater than 1/2
  * the size of the hashTable array, the array is resized
- * if keys are ints then a seperate hash function is called
- * @param hashObjects : vector of Object pointers
  * @param keys : vector of keys
  */
-HashTable::HashTable(vector<Object*> hashObjects, vector<string> keys) {
+HashTable::HashTable(vector<string> keys) {
 
-    build(hashObjects, keys);
+    build(move(keys));
 }
 
 /**
@@ -83,29 +138,50 @@ HashTable::~HashTable() {
 
 /**
 * build
-* this function takes in vector of Object pointersand auto keys
-* and creates a hashtable
-* if the number of elements in hashObjects is greater than 1 / 2
-* the size of the hashTable array, the array is resized
-* if keys are ints then a seperate hash function is called
-* @param hashObjects : vector of Object pointers
+* this function creates the hashtable where the ID of keys[i]
+* is i, a repeated key keeps its first ID
+* Preconditions: none
+* Postconditions: the hashtable holds every key
 * @param keys : vector of keys
 */
-void HashTable::build(vector<Object*> hashObjects, vector<string> keys) {
-    numItems = hashObjects.size();
-    size = numItems * 2;
-    hashTable = vector<Item*>(size, nullptr);
-    //initialize new Item object to hold hashObject and key
-    for (int i = 0; i < numItems; i++) {
-            Item* newItem = new Item(); //memory leak
-            newItem->value = hashObjects[i];
-            newItem->key = keys[i];
-            //insert into table based on hash index
-            hashTable[hash(newItem->key)] = newItem;
+void HashTable::build(vector<string> keys) {
+    vector<uint64_t> hashes;
+    hashes.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        hashes.push_back(Fingerprint::of(keys[i]));
     }
+    build(move(keys), hashes);
+}
 
-    for (int i = 0; i < hashObjects.size(); i++) {
-        hashObjects[i] = nullptr;
+/**
+ * build
+ * this function creates the hashtable like build above with
+ * fingerprints of the keys that were already computed
+ * Preconditions: hashes[i] must be the Fingerprint of keys[i]
+ * Postconditions: the hashtable holds every key
+ * @param keys : vector of keys
+ * @param hashes : vector of the fingerprints of the keys
+ */
+void HashTable::build(vector<string> keys, const vector<uint64_t>& hashes) {
+    numItems = keys.size();
+    size = numItems * 2 + 1;
+    hashTable = vector<int>(size, -1);
+    items.clear();
+    items.reserve(numItems);
+    //add an Item for each key and point its slot at it
+    for (size_t i = 0; i < keys.size(); i++) {
+        size_t index = findSlot(keys[i], hashes[i]);
+        if (hashTable[index] >= 0) {
+            //a repeated key keeps the first ID
+            numItems--;
+            continue;
+        }
+        Item item;
+        item.id = static_cast<uint32_t>(i);
+        item.key = move(keys[i]);
+        item.hash = hashes[i];
+        hashTable[index] = static_cast<int>(items.size());
+        items.push_back(move(item));
     }
 }
 
@@ -118,33 +194,26 @@ void HashTable::build(vector<Object*> hashObjects, vector<string> keys) {
  *
  */
 void HashTable::clear() {
-    for (int i = 0; i < numItems; i++) {
-        if (hashTable[i] != nullptr) {
-            if (hashTable[i]->value != nullptr) {
-                //delete value stored in Item
-                delete hashTable[i]->value;
-            }
-            //delete Item
-            delete hashTable[i];
-        }
-    }
+    items.clear();
     hashTable.clear();
+    size = 0;
+    numItems = 0;
 }
 
 /**
- * @brief Get the Value object
- *
- * @param key
- * @return Object*
+ * getId
+ * this function finds the ID stored under key
+ * Preconditions: none
+ * Postconditions: returns the ID of key, notFound if key is
+ * not in the table
+ * @param key : string representing the key
  */
-Object* HashTable::getValue(string key) const {
-    // call the hash function on the key and then go to
-    Item* item = hashTable[hash(key)];
-    if (item == nullptr) {
-        return nullptr;
-    } 
-    return item->value;
-    
+uint32_t HashTable::getId(const string& key) const {
+    if (size == 0) {
+        return notFound;
+    }
+    int item = hashTable[findSlot(key, Fingerprint::of(key))];
+    return item < 0 ? notFound : items[item].id;
 }
 
 
@@ -1,21 +1,26 @@
 #pragma once
 #include <vector>
-#include "Object.h"
 #include <string>
+#include <cstdint>
+#include "Fingerprint.h"
 using namespace std;
 #include <iostream>
 /*
  * @file HashTable.h
  * @author Katarina McGaughy
  * HashTable class creates a hash table of objects with strings as keys.
+ * It stores the dense ID of each object, the objects themselves are
+ * found by ID in an IdTable.
  *
  *
  * Features:
- * -getObject
+ * -getId
  * -clear
  * -isEmpty
  * -resizeArray
  * -hash
+ * -compare fingerprints before whole keys
+ * -insert one key at a time, growing in amortized O(1)
  *
  * @version 0.1
  * @date 2022-2-21
@@ -30,47 +35,74 @@ class HashTable
 
 private:
     /**
-     * Item struct holds a string key and a pointer
-     * to an Object
+     * Item struct holds a string key and the ID
+     * of its object
      *
      */
     struct Item
     {
 
         string key = "";
-        Object* value = nullptr;
+        uint64_t hash = 0;      // Fingerprint of key
+        uint32_t id = 0;        // ID of the object of key
     };
 
-    vector<Item*> hashTable;     // hashtable storing items
-    int size = 0;
-    int numItems = 0;
+    vector<Item> items;          // items in the order they were added
+    vector<int> hashTable;       // index in items of each slot, -1 if empty
+    size_t size = 0;
+    size_t numItems = 0;
 
 
     /**
      * hash
-     * this function takes in a key and then returns
-     * an index where the Object will be inserted
+     * this function takes in the fingerprint of a key and then
+     * returns the index its probe sequence starts at
+     * @param keyHash : Fingerprint of the key
+     * @return size_t : index
+     */
+    size_t hash(uint64_t keyHash) const;
+
+    /**
+     * findSlot
+     * this function probes from the hash of key and returns the index
+     * of the Item holding key, or of the first empty slot if no Item
+     * holds key, keys are only compared when the fingerprints match
+     * Preconditions: hashTable must have at least one empty slot
+     * Postconditions: returns the index of key or of an empty slot
      * @param key : string representing the key
-     * @return int : index
+     * @param keyHash : Fingerprint of key
+     * @return size_t : index
+     */
+    size_t findSlot(const string& key, uint64_t keyHash) const;
+
+    /**
+     * grow
+     * this function makes the table newSize slots and puts every
+     * Item back in its slot with the fingerprint it already has
+     * Preconditions: newSize must be more than twice numItems
+     * Postconditions: every key is found in the larger table
+     * @param newSize : number of slots
      */
-    int hash(string key) const;
+    void grow(size_t newSize);
 
 public:
+    static constexpr uint32_t notFound = UINT32_MAX;   // ID of a key not in the table
 
     HashTable() {
     }
 
     /**
      * @brief Construct a new Hash Table object
-     * Constructor takes in vector of Object pointers and auto keys
-     * and creates a hashtable
-     * if the number of elements in hashObjects is greater than 1/2
+     * Constructor takes in vector of keys and creates a hashtable
+     * where the ID of keys[i] is i
+     * if the number of keys is greater than 1/2
      * the size of the hashTable array, the array is resized
-     * if keys are ints then a seperate hash function is called
-     * @param hashObjects : vector of Object pointers
      * @param keys : vector of keys
      */
-    HashTable(vector<Object*> hashObjects, vector<string> keys);
+    HashTable(vector<string> keys);
+
+    HashTable(const HashTable&) = delete;
+    HashTable& operator=(const HashTable&) = delete;
 
     /**
      * @brief Destroy the Hash Table object
@@ -78,7 +110,39 @@ public:
      */
     ~HashTable();
 
-    void build(vector<Object*> hashObjects, vector<string> keys);
+    /**
+     * build
+     * this function creates the hashtable where the ID of keys[i]
+     * is i, a repeated key keeps its first ID
+     * Preconditions: none
+     * Postconditions: the hashtable holds every key
+     * @param keys : vector of keys
+     */
+    void build(vector<string> keys);
+
+    /**
+     * build
+     * this function creates the hashtable like build above with
+     * fingerprints of the keys that were already computed
+     * Preconditions: hashes[i] must be the Fingerprint of keys[i]
+     * Postconditions: the hashtable holds every key
+     * @param keys : vector of keys
+     * @param hashes : vector of the fingerprints of the keys
+     */
+    void build(vector<string> keys, const vector<uint64_t>& hashes);
+
+    /**
+     * insert
+     * this function adds id under key, the table doubles when
+     * it would be more than half full so each insert is amortized O(1)
+     * Preconditions: none
+     * Postconditions: returns false and adds nothing if key is
+     * already in the table
+     * @param key : string representing the key
+     * @param id : ID of the object of key
+     * @return true : if id was added
+     */
+    bool insert(const string& key, uint32_t id);
 
     /**
      * clear
@@ -90,13 +154,14 @@ public:
     void clear();
 
     /**
-     * @brief Get the Value object
-     *
-     * @param key
-     * @return Object*
+     * getId
+     * this function finds the ID stored under key
+     * Preconditions: none
+     * Postconditions: returns the ID of key, notFound if key is
+     * not in the table
+     * @param key : string representing the key
      */
-    Object* getValue(string key) const; // call the hash function on the key and then go to
-    // given index
+    uint32_t getId(const string& key) const;
 
 
     /**
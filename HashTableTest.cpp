@@ -0,0 +1,88 @@
+#include "HashTable.h"
+#include "TestCheck.h"
+/*
+ * @file HashTableTest.cpp
+ * @author Katarina McGaughy
+ * HashTableTest checks that HashTable finds the ID of every key after
+ * it is built or grown one insert at a time and that a repeated key
+ * keeps its first ID.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 HashTableTest.cpp HashTable.cpp -o HashTableTest
+ * ./HashTableTest
+ *
+ * Features:
+ * -build with repeated keys
+ * -inserts that grow the table many times
+ * -repeated inserts are refused
+ * -keys that are not in the table and clear
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * testBuild
+  * build gives keys[i] the ID i and a repeated key its first ID
+  */
+static void testBuild() {
+    HashTable table;
+    CHECK(table.isEmpty());
+    CHECK(table.getId("456") == HashTable::notFound);
+    table.build({ "456", "123", "456", "789", "123" });
+    CHECK(!table.isEmpty());
+    CHECK(table.getId("456") == 0);
+    CHECK(table.getId("123") == 1);
+    CHECK(table.getId("789") == 3);
+    CHECK(table.getId("999") == HashTable::notFound);
+    CHECK(table.getId("") == HashTable::notFound);
+
+    //a key added after the build is found with the rest
+    CHECK(!table.insert("789", 9));
+    CHECK(table.insert("999", 9));
+    CHECK(table.getId("999") == 9);
+    CHECK(table.getId("789") == 3);
+
+    table.build({});
+    CHECK(table.isEmpty());
+    CHECK(table.getId("456") == HashTable::notFound);
+}
+
+/**
+ * testGrow
+ * a table that starts empty grows as keys are inserted and still
+ * finds every key
+ */
+static void testGrow() {
+    HashTable table;
+    bool inserted = true;
+    for (uint32_t i = 0; i < 5000; i++) {
+        inserted = inserted && table.insert(to_string(i * 7), i);
+    }
+    CHECK(inserted);
+    bool found = true;
+    bool refused = true;
+    for (uint32_t i = 0; i < 5000; i++) {
+        found = found && table.getId(to_string(i * 7)) == i;
+        found = found && (i % 7 == 0 || table.getId(to_string(i)) == HashTable::notFound);
+        refused = refused && !table.insert(to_string(i * 7), i + 1);
+    }
+    CHECK(found);
+    CHECK(refused);
+    CHECK(table.getId("34993") == 4999);
+
+    table.clear();
+    CHECK(table.isEmpty());
+    CHECK(table.getId("0") == HashTable::notFound);
+    CHECK(table.insert("0", 5));
+    CHECK(table.getId("0") == 5);
+}
+
+int main() {
+    testBuild();
+    testGrow();
+    return TestCheck::report("HashTableTest");
+}
@@ -0,0 +1,349 @@
+#include "HistorySegment.h"
+#include "TransactionJournal.h"
+#include <cstdio>
+#include <algorithm>
+/*
+ * @file HistorySegment.cpp
+ * @author Katarina McGaughy
+ * HistorySegment is the cold tier of the transaction history. Older
+ * transactions of a customer are spilled to a segment file as one
+ * block, each transaction packed as the varint gaps to the time and
+ * the sequence number before it, the varint ID of its item and its
+ * type. The blocks of every customer are indexed in memory by its ID
+ * with their times, and every item keeps which blocks hold it, so
+ * only the blocks that hold the wanted transactions are read back.
+ *
+ * Features:
+ * -spill transactions of a customer to the segment file
+ * -count and render the spilled transactions of a customer
+ * -count and read back the spilled transactions of an item
+ *
+ * Assumptions:
+ * -the file is scratch space for one run, not a saved history: it
+ * is truncated on the first spill and removed when the
+ * HistorySegment is destroyed
+ * -the IDs in the file are resolved by the journal that spilled them
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * appendVarint
+  * this function appends value to out 7 bits at a time, lowest
+  * first, with the high bit set on every byte but the last
+  * @param out : string to append to
+  * @param value : value to append
+  */
+static void appendVarint(string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+/**
+ * readVarint
+ * this function reads a value written by appendVarint at pos
+ * @param data : bytes to read
+ * @param pos : position of the value, moved past it
+ * @param value : set to the value read
+ * @return true : if a whole value was read
+ */
+static bool readVarint(const string& data, size_t& pos, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; pos < data.size() && shift < 64; shift += 7) {
+        unsigned char byte = static_cast<unsigned char>(data[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Destroy the HistorySegment object
+ * closes and removes the file, it is only scratch space
+ */
+HistorySegment::~HistorySegment() {
+    if (file.is_open()) {
+        file.close();
+        remove(path.c_str());
+    }
+}
+
+/**
+ * setPath
+ * this function sets the file transactions are spilled to
+ * Preconditions: nothing has been spilled
+ * Postconditions: the file is created on the first spill
+ * @param p : segment file
+ */
+void HistorySegment::setPath(const string& p) {
+    path = p;
+}
+
+/**
+ * hasPath
+ * Preconditions: none
+ * Postconditions: returns true if transactions can be spilled
+ */
+bool HistorySegment::hasPath() const {
+    return !path.empty();
+}
+
+/**
+ * spill
+ * this function writes the transactions in rows of the journal
+ * to the end of the file as one block of customerId
+ * Preconditions: rows must be in journal order and newer than
+ * every row spilled for customerId before
+ * Postconditions: returns false if the file could not be
+ * written, nothing is spilled then
+ * @param customerId : ID of the customer of the rows
+ * @param journal : journal the rows are in
+ * @param rows : rows of the journal to spill
+ * @param count : number of rows
+ */
+bool HistorySegment::spill(uint32_t customerId, const TransactionJournal& journal,
+    const uint32_t* rows, size_t count) {
+    if (count == 0 || path.empty()) {
+        return false;
+    }
+    if (!file.is_open()) {
+        file.open(path, ios::in | ios::out | ios::binary | ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+    }
+    Block block;
+    block.offset = fileSize;
+    block.count = static_cast<uint32_t>(count);
+    block.firstTime = journal.getTime(rows[0]);
+    block.firstSequence = journal.getSequence(rows[0]);
+    //times and sequence numbers never go down so the gaps are never negative
+    string encoded;
+    int64_t previous = block.firstTime;
+    uint32_t previousSequence = block.firstSequence;
+    for (size_t i = 0; i < count; i++) {
+        int64_t time = journal.getTime(rows[i]);
+        uint32_t sequence = journal.getSequence(rows[i]);
+        appendVarint(encoded, static_cast<uint64_t>(time - previous));
+        appendVarint(encoded, sequence - previousSequence);
+        appendVarint(encoded, journal.getItemId(rows[i]));
+        encoded.push_back(journal.getTransaction(rows[i]).getType());
+        previous = time;
+        previousSequence = sequence;
+    }
+    block.lastTime = previous;
+    block.bytes = static_cast<uint32_t>(encoded.size());
+    file.clear();
+    file.seekp(static_cast<streamoff>(fileSize));
+    file.write(encoded.data(), static_cast<streamsize>(encoded.size()));
+    file.flush();
+    if (!file) {
+        file.clear();
+        return false;
+    }
+    fileSize += encoded.size();
+    if (customerId >= blocks.size()) {
+        blocks.resize(customerId + 1);
+    }
+    BlockRef ref;
+    ref.customerId = customerId;
+    ref.index = static_cast<uint32_t>(blocks[customerId].size());
+    blocks[customerId].push_back(block);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t itemId = journal.getItemId(rows[i]);
+        if (itemId >= itemSpilled.size()) {
+            itemSpilled.resize(itemId + 1, 0);
+            itemBlocks.resize(itemId + 1);
+        }
+        itemSpilled[itemId]++;
+        //an item bought several times in the block is listed once
+        vector<BlockRef>& refs = itemBlocks[itemId];
+        if (refs.empty() || refs.back().customerId != ref.customerId ||
+            refs.back().index != ref.index) {
+            refs.push_back(ref);
+        }
+    }
+    return true;
+}
+
+/**
+ * getCount
+ * Preconditions: none
+ * Postconditions: returns the number of spilled transactions of
+ * customerId
+ * @param customerId : ID of the customer to look up
+ */
+size_t HistorySegment::getCount(uint32_t customerId) const {
+    if (customerId >= blocks.size()) {
+        return 0;
+    }
+    size_t count = 0;
+    for (const Block& block : blocks[customerId]) {
+        count += block.count;
+    }
+    return count;
+}
+
+/**
+ * getItemCount
+ * Preconditions: none
+ * Postconditions: returns the number of spilled transactions of
+ * itemId
+ * @param itemId : ID of the item to look up
+ */
+size_t HistorySegment::getItemCount(uint32_t itemId) const {
+    return itemId < itemSpilled.size() ? itemSpilled[itemId] : 0;
+}
+
+/**
+ * readBlock
+ * this function reads block back from the file into buffer
+ * Preconditions: block must be in the file
+ * Postconditions: returns false if it could not be read
+ * @param block : block to read
+ * @param buffer : set to the bytes of the block
+ */
+bool HistorySegment::readBlock(const Block& block, string& buffer) const {
+    buffer.resize(block.bytes);
+    file.clear();
+    file.seekg(static_cast<streamoff>(block.offset));
+    file.read(&buffer[0], block.bytes);
+    if (!file) {
+        file.clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * readRow
+ * this function reads the transaction at pos of a block, row
+ * must hold the transaction before it or the first time and
+ * sequence number of the block
+ * Preconditions: pos must be at a transaction of buffer
+ * Postconditions: returns false if the bytes are not a whole
+ * transaction
+ * @param buffer : bytes of the block
+ * @param pos : position of the transaction, moved past it
+ * @param row : set to the transaction
+ */
+bool HistorySegment::readRow(const string& buffer, size_t& pos, Row& row) {
+    uint64_t gap = 0;
+    uint64_t sequenceGap = 0;
+    uint64_t itemId = 0;
+    if (!readVarint(buffer, pos, gap) || !readVarint(buffer, pos, sequenceGap) ||
+        !readVarint(buffer, pos, itemId) || pos >= buffer.size() || itemId >= UINT32_MAX) {
+        return false;
+    }
+    row.time += static_cast<int64_t>(gap);
+    row.sequence += static_cast<uint32_t>(sequenceGap);
+    row.itemId = static_cast<uint32_t>(itemId);
+    row.type = buffer[pos++];
+    return true;
+}
+
+/**
+ * render
+ * this function appends the lines of the spilled transactions of
+ * customerId made from from to to, skipping offset of them and
+ * showing at most limit, only the blocks that are needed are read
+ * Preconditions: journal must be the one the rows were spilled from
+ * Postconditions: the lines are appended to out, returns the
+ * number of spilled transactions in the range
+ * @param customerId : ID of the customer to look up
+ * @param journal : journal the item IDs are resolved with
+ * @param from : first second of the range
+ * @param to : last second of the range
+ * @param offset : transactions of the range to skip
+ * @param limit : most transactions to show
+ * @param out : string the lines are appended to
+ */
+size_t HistorySegment::render(uint32_t customerId, const TransactionJournal& journal,
+    int64_t from, int64_t to, size_t offset, size_t limit, string& out) const {
+    if (customerId >= blocks.size()) {
+        return 0;
+    }
+    size_t end = limit > SIZE_MAX - offset ? SIZE_MAX : offset + limit;
+    size_t inRange = 0;
+    string buffer;
+    for (const Block& block : blocks[customerId]) {
+        if (block.lastTime < from || block.firstTime > to) {
+            continue;
+        }
+        //a block wholly in the range that shows nothing is only counted
+        bool whole = block.firstTime >= from && block.lastTime <= to;
+        if (whole && (inRange + block.count <= offset || inRange >= end)) {
+            inRange += block.count;
+            continue;
+        }
+        if (!readBlock(block, buffer)) {
+            continue;
+        }
+        size_t pos = 0;
+        Row row;
+        row.time = block.firstTime;
+        row.sequence = block.firstSequence;
+        for (uint32_t i = 0; i < block.count; i++) {
+            if (!readRow(buffer, pos, row)) {
+                break;
+            }
+            Collectible* item = journal.getItemById(row.itemId);
+            if (item == nullptr) {
+                break;
+            }
+            if (row.time < from || row.time > to) {
+                continue;
+            }
+            if (inRange >= offset && inRange < end) {
+                Transaction(item, row.type).appendTransaction(out);
+            }
+            inRange++;
+        }
+    }
+    return inRange;
+}
+
+/**
+ * readItem
+ * this function reads back the spilled transactions of itemId,
+ * only the blocks that hold the item are read
+ * Preconditions: none
+ * Postconditions: returns the transactions in sequence order
+ * @param itemId : ID of the item to look up
+ */
+vector<HistorySegment::ItemRow> HistorySegment::readItem(uint32_t itemId) const {
+    vector<ItemRow> found;
+    if (itemId >= itemBlocks.size()) {
+        return found;
+    }
+    string buffer;
+    for (const BlockRef& ref : itemBlocks[itemId]) {
+        const Block& block = blocks[ref.customerId][ref.index];
+        if (!readBlock(block, buffer)) {
+            continue;
+        }
+        size_t pos = 0;
+        Row row;
+        row.time = block.firstTime;
+        row.sequence = block.firstSequence;
+        for (uint32_t i = 0; i < block.count && readRow(buffer, pos, row); i++) {
+            if (row.itemId == itemId) {
+                found.push_back({ row.sequence, ref.customerId, row.type });
+            }
+        }
+    }
+    //the blocks of different customers interleave in time
+    sort(found.begin(), found.end(), [](const ItemRow& a, const ItemRow& b) {
+        return a.sequence < b.sequence;
+    });
+    return found;
+}
@@ -0,0 +1,224 @@
+#pragma once
+/*
+ * @file HistorySegment.h
+ * @author Katarina McGaughy
+ * HistorySegment is the cold tier of the transaction history. Older
+ * transactions of a customer are spilled to a segment file as one
+ * block, each transaction packed as the varint gaps to the time and
+ * the sequence number before it, the varint ID of its item and its
+ * type. The blocks of every customer are indexed in memory by its ID
+ * with their times, and every item keeps which blocks hold it, so
+ * only the blocks that hold the wanted transactions are read back.
+ *
+ * Features:
+ * -spill transactions of a customer to the segment file
+ * -count and render the spilled transactions of a customer
+ * -count and read back the spilled transactions of an item
+ *
+ * Assumptions:
+ * -the file is scratch space for one run, not a saved history: it
+ * is truncated on the first spill and removed when the
+ * HistorySegment is destroyed
+ * -the IDs in the file are resolved by the journal that spilled them
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+using namespace std;
+
+class TransactionJournal;
+
+/**
+ * CompactionPolicy struct decides when the journal is compacted and
+ * which transactions of each customer stay in memory, a transaction
+ * stays if it is one of the newest keepLast or newer than keepDays
+ */
+struct CompactionPolicy
+{
+    size_t maxRows = SIZE_MAX;      // journal rows that start a compaction
+    size_t keepLast = SIZE_MAX;     // newest transactions of a customer kept
+    int keepDays = -1;              // days of transactions kept, -1 for none
+};
+
+class HistorySegment
+{
+private:
+    /**
+     * Block struct is where the spilled transactions of one
+     * compaction of a customer are in the file
+     */
+    struct Block
+    {
+        uint64_t offset = 0;    // first byte in the file
+        uint32_t bytes = 0;     // length in the file
+        uint32_t count = 0;     // transactions in the block
+        int64_t firstTime = 0;  // time of the first transaction
+        int64_t lastTime = 0;   // time of the last transaction
+        uint32_t firstSequence = 0;     // sequence number of the first transaction
+    };
+
+    /**
+     * BlockRef struct is a block of one customer that holds
+     * transactions of an item
+     */
+    struct BlockRef
+    {
+        uint32_t customerId = 0;    // customer of the block
+        uint32_t index = 0;         // index in the blocks of the customer
+    };
+
+    /**
+     * Row struct is one transaction read back from a block
+     */
+    struct Row
+    {
+        int64_t time = 0;
+        uint32_t sequence = 0;
+        uint32_t itemId = 0;
+        char type = 0;
+    };
+
+    string path;                // segment file, empty for none
+    mutable fstream file;       // open after the first spill
+    uint64_t fileSize = 0;      // bytes written to the file
+    vector<vector<Block>> blocks;   // blocks of each customer by ID in order
+    vector<uint32_t> itemSpilled;   // spilled transactions of each item by ID
+    vector<vector<BlockRef>> itemBlocks;    // blocks that hold each item by ID
+
+    /**
+     * readBlock
+     * this function reads block back from the file into buffer
+     * Preconditions: block must be in the file
+     * Postconditions: returns false if it could not be read
+     * @param block : block to read
+     * @param buffer : set to the bytes of the block
+     */
+    bool readBlock(const Block& block, string& buffer) const;
+
+    /**
+     * readRow
+     * this function reads the transaction at pos of a block, row
+     * must hold the transaction before it or the first time and
+     * sequence number of the block
+     * Preconditions: pos must be at a transaction of buffer
+     * Postconditions: returns false if the bytes are not a whole
+     * transaction
+     * @param buffer : bytes of the block
+     * @param pos : position of the transaction, moved past it
+     * @param row : set to the transaction
+     */
+    static bool readRow(const string& buffer, size_t& pos, Row& row);
+
+public:
+
+    /**
+     * @brief Construct a new HistorySegment object
+     * with no file
+     */
+    HistorySegment() {}
+
+    /**
+     * @brief Destroy the HistorySegment object
+     * closes and removes the file, it is only scratch space
+     */
+    ~HistorySegment();
+
+    HistorySegment(const HistorySegment&) = delete;
+    HistorySegment& operator=(const HistorySegment&) = delete;
+
+    /**
+     * setPath
+     * this function sets the file transactions are spilled to
+     * Preconditions: nothing has been spilled
+     * Postconditions: the file is created on the first spill
+     * @param p : segment file
+     */
+    void setPath(const string& p);
+
+    /**
+     * hasPath
+     * Preconditions: none
+     * Postconditions: returns true if transactions can be spilled
+     */
+    bool hasPath() const;
+
+    /**
+     * spill
+     * this function writes the transactions in rows of the journal
+     * to the end of the file as one block of customerId
+     * Preconditions: rows must be in journal order and newer than
+     * every row spilled for customerId before
+     * Postconditions: returns false if the file could not be
+     * written, nothing is spilled then
+     * @param customerId : ID of the customer of the rows
+     * @param journal : journal the rows are in
+     * @param rows : rows of the journal to spill
+     * @param count : number of rows
+     */
+    bool spill(uint32_t customerId, const TransactionJournal& journal,
+        const uint32_t* rows, size_t count);
+
+    /**
+     * getCount
+     * Preconditions: none
+     * Postconditions: returns the number of spilled transactions of
+     * customerId
+     * @param customerId : ID of the customer to look up
+     */
+    size_t getCount(uint32_t customerId) const;
+
+    /**
+     * getItemCount
+     * Preconditions: none
+     * Postconditions: returns the number of spilled transactions of
+     * itemId
+     * @param itemId : ID of the item to look up
+     */
+    size_t getItemCount(uint32_t itemId) const;
+
+    /**
+     * render
+     * this function appends the lines of the spilled transactions of
+     * customerId made from from to to, skipping offset of them and
+     * showing at most limit, only the blocks that are needed are read
+     * Preconditions: journal must be the one the rows were spilled from
+     * Postconditions: the lines are appended to out, returns the
+     * number of spilled transactions in the range
+     * @param customerId : ID of the customer to look up
+     * @param journal : journal the item IDs are resolved with
+     * @param from : first second of the range
+     * @param to : last second of the range
+     * @param offset : transactions of the range to skip
+     * @param limit : most transactions to show
+     * @param out : string the lines are appended to
+     */
+    size_t render(uint32_t customerId, const TransactionJournal& journal,
+        int64_t from, int64_t to, size_t offset, size_t limit, string& out) const;
+
+    /**
+     * ItemRow struct is a spilled transaction of an item
+     */
+    struct ItemRow
+    {
+        uint32_t sequence = 0;      // sequence number in the journal
+        uint32_t customerId = 0;    // customer of the transaction
+        char type = 0;              // B, S or F
+    };
+
+    /**
+     * readItem
+     * this function reads back the spilled transactions of itemId,
+     * only the blocks that hold the item are read
+     * Preconditions: none
+     * Postconditions: returns the transactions in sequence order
+     * @param itemId : ID of the item to look up
+     */
+    vector<ItemRow> readItem(uint32_t itemId) const;
+};
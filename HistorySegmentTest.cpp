@@ -0,0 +1,220 @@
+#include "HistorySegment.h"
+#include "TransactionJournal.h"
+#include "CollectibleStore.h"
+#include "TestCheck.h"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+/*
+ * @file HistorySegmentTest.cpp
+ * @author Katarina McGaughy
+ * HistorySegmentTest checks that spilled transactions are read back
+ * from the segment file as they were written and that a store that
+ * compacts its journal shows the same histories as one that does not.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -pthread HistorySegmentTest.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o HistorySegmentTest
+ * ./HistorySegmentTest
+ *
+ * Features:
+ * -item IDs and sequence gaps that take several bytes
+ * -items spilled in blocks of several customers
+ * -rows dropped from the journal and moved
+ * -C and I of a compacted store against a store that is not
+ * -the file is removed with the segment
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+static const char* segmentPath = "historytest.seg";
+
+/**
+ * fileExists
+ * Preconditions: none
+ * Postconditions: returns true if path can be opened
+ * @param path : file to look for
+ */
+static bool fileExists(const char* path) {
+    ifstream in(path, ios::binary);
+    return in.is_open();
+}
+
+/**
+ * testRoundTrip
+ * rows spilled in several blocks are read back per item in sequence
+ * order and the journal keeps the rest
+ */
+static void testRoundTrip() {
+    const char types[] = { 'B', 'S', 'F' };
+    TransactionJournal journal;
+    for (uint32_t i = 0; i < 3000; i++) {
+        //item IDs up to 20000 and sequence gaps of 300 take several bytes
+        journal.append(i % 3, (i * 7919) % 20000, types[(i / 3) % 3]);
+    }
+    vector<uint32_t> first;
+    vector<uint32_t> second;
+    vector<uint32_t> other;
+    for (uint32_t row = 0; row < 3000; row++) {
+        if (row % 300 == 1) {
+            (row < 1500 ? first : second).push_back(row);
+        }
+        else if (row % 3 == 2 && row < 900) {
+            other.push_back(row);
+        }
+    }
+
+    //the rows each item should read back, in sequence order
+    vector<vector<HistorySegment::ItemRow>> expected(20000);
+    vector<bool> spilled(journal.size(), false);
+    for (uint32_t row = 0; row < 3000; row++) {
+        if (row % 300 == 1 || (row % 3 == 2 && row < 900)) {
+            HistorySegment::ItemRow item;
+            item.sequence = journal.getSequence(row);
+            item.customerId = row % 3;
+            item.type = types[(row / 3) % 3];
+            expected[journal.getItemId(row)].push_back(item);
+            spilled[row] = true;
+        }
+    }
+
+    {
+        HistorySegment segment;
+        CHECK(!segment.hasPath());
+        CHECK(!segment.spill(1, journal, first.data(), first.size()));
+        segment.setPath(segmentPath);
+        CHECK(segment.spill(1, journal, first.data(), first.size()));
+        CHECK(segment.spill(2, journal, other.data(), other.size()));
+        CHECK(segment.spill(1, journal, second.data(), second.size()));
+        CHECK(fileExists(segmentPath));
+        CHECK(segment.getCount(1) == 10);
+        CHECK(segment.getCount(2) == 300);
+        CHECK(segment.getCount(0) == 0);
+        CHECK(segment.getCount(99) == 0);
+        CHECK(segment.readItem(99999).empty());
+
+        bool same = true;
+        for (uint32_t itemId = 0; itemId < expected.size(); itemId++) {
+            vector<HistorySegment::ItemRow> found = segment.readItem(itemId);
+            same = same && found.size() == expected[itemId].size() &&
+                segment.getItemCount(itemId) == found.size();
+            for (size_t i = 0; same && i < found.size(); i++) {
+                same = found[i].sequence == expected[itemId][i].sequence &&
+                    found[i].customerId == expected[itemId][i].customerId &&
+                    found[i].type == expected[itemId][i].type;
+            }
+        }
+        CHECK(same);
+    }
+    CHECK(!fileExists(segmentPath));
+
+    //the kept rows move down and keep their sequence numbers
+    vector<uint32_t> moved = journal.removeRows(spilled);
+    CHECK(journal.size() == 3000 - 310);
+    CHECK(moved[1] == UINT32_MAX && moved[2] == UINT32_MAX);
+    CHECK(moved[0] == 0 && moved[3] == 1 && moved[2999] == 3000 - 311);
+    CHECK(journal.getSequence(moved[3]) == 4);
+    CHECK(journal.getItemId(moved[2999]) == (2999u * 7919) % 20000);
+    CHECK(journal.getSequence(moved[2999]) == 3000);
+}
+
+/**
+ * writeFile
+ * this function writes text to the file path
+ * @param path : file to write
+ * @param text : contents of the file
+ */
+static void writeFile(const char* path, const string& text) {
+    ofstream out(path, ios::binary);
+    out << text;
+}
+
+/**
+ * run
+ * this function loads a small store and runs commands, compacting
+ * the journal every few rows if compact is true
+ * @param commandText : commands
+ * @param compact : true to spill all but the newest transaction
+ * of each customer
+ * @param spilledBytes : set to the size of the segment file
+ * @return what the commands printed
+ */
+static string run(const string& commandText, bool compact, long& spilledBytes) {
+    writeFile("historytest_inventory.txt",
+        "M, 10, 1913, 70, Liberty Nickel\n"
+        "M, 10, 2001, 65, Lincoln Cent\n"
+        "C, 10, 1938, Mint, Superman, DC\n");
+    writeFile("historytest_customers.txt",
+        "456, Donald Duck\n"
+        "123, Daisy Duck\n");
+    writeFile("historytest_commands.txt", commandText);
+    ostringstream printed;
+    streambuf* old = cout.rdbuf(printed.rdbuf());
+    spilledBytes = 0;
+    {
+        CollectibleStore store;
+        if (compact) {
+            CompactionPolicy compaction;
+            compaction.maxRows = 4;
+            compaction.keepLast = 1;
+            store.setCompaction(compaction, segmentPath);
+        }
+        InputSource inventoryFile("historytest_inventory.txt");
+        store.initializeInventory(inventoryFile);
+        InputSource customerFile("historytest_customers.txt");
+        store.initializeCustomers(customerFile);
+        cout << "Executing commands: " << endl;
+        InputSource commandFile("historytest_commands.txt");
+        store.getCommands(commandFile);
+        ifstream spilled(segmentPath, ios::binary | ios::ate);
+        if (spilled.is_open()) {
+            spilledBytes = static_cast<long>(spilled.tellg());
+        }
+    }
+    cout.rdbuf(old);
+    remove("historytest_inventory.txt");
+    remove("historytest_customers.txt");
+    remove("historytest_commands.txt");
+    string out = printed.str();
+    return out.substr(out.find("Executing commands: \n") + 21);
+}
+
+/**
+ * testCompaction
+ * a store that spills its history shows the same C and I output
+ * as one that keeps everything in memory
+ */
+static void testCompaction() {
+    string commands;
+    const char* items[] = { "M, 1913, 70, Liberty Nickel", "M, 2001, 65, Lincoln Cent",
+        "C, 1938, Mint, Superman, DC" };
+    for (int i = 0; i < 30; i++) {
+        commands += string(i % 4 == 3 ? "B" : "S") + (i % 2 == 0 ? ", 456, " : ", 123, ") +
+            items[i % 3] + "\n";
+        if (i % 7 == 6) {
+            commands += "C, 456\nI, " + string(items[0]) + "\n";
+        }
+    }
+    commands += "C, 456\nC, 123\nC, 456, 2, 3\nC, 123, 2000-01-01, 2999-12-31, 4, 2\n";
+    for (const char* item : items) {
+        commands += "I, " + string(item) + "\n";
+    }
+
+    long spilledBytes = 0;
+    string kept = run(commands, false, spilledBytes);
+    CHECK(spilledBytes == 0);
+    string compacted = run(commands, true, spilledBytes);
+    CHECK(spilledBytes > 0);
+    CHECK(kept == compacted);
+    CHECK(kept.find("#29 123 Daisy Duck:") != string::npos);
+    CHECK(!fileExists(segmentPath));
+}
+
+int main() {
+    testRoundTrip();
+    testCompaction();
+    return TestCheck::report("HistorySegmentTest");
+}
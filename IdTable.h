@@ -0,0 +1,86 @@
+#pragma once
+/*
+ * @file IdTable.h
+ * @author Katarina McGaughy
+ * IdTable gives each object a dense 32 bit ID in the order they are
+ * added and finds the object of an ID in O(1). Indexes and the
+ * transaction history hold the IDs instead of pointers, so they take
+ * half the space and do not depend on where the objects live.
+ *
+ * Features:
+ * -add an object and get its ID
+ * -get the object of an ID
+ *
+ * Assumptions:
+ * -the table does not own the objects, they outlive it
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <vector>
+#include <cstdint>
+using namespace std;
+
+template <class T>
+class IdTable
+{
+private:
+    vector<T*> objects;     // object of each ID
+
+public:
+    static constexpr uint32_t none = UINT32_MAX;    // ID of no object
+
+    /**
+     * add
+     * Preconditions: object must not be nullptr
+     * Postconditions: returns the ID of object, the next unused one
+     * @param object : object to give an ID
+     */
+    uint32_t add(T* object) {
+        objects.push_back(object);
+        return static_cast<uint32_t>(objects.size() - 1);
+    }
+
+    /**
+     * get
+     * Preconditions: none
+     * Postconditions: returns the object of id, nullptr if id was
+     * never given out
+     * @param id : ID of the object
+     */
+    T* get(uint32_t id) const {
+        return id < objects.size() ? objects[id] : nullptr;
+    }
+
+    /**
+     * size
+     * Preconditions: none
+     * Postconditions: returns the number of IDs given out
+     */
+    size_t size() const {
+        return objects.size();
+    }
+
+    /**
+     * reserve
+     * Preconditions: none
+     * Postconditions: count objects can be added without moving
+     * the table
+     * @param count : number of objects expected
+     */
+    void reserve(size_t count) {
+        objects.reserve(count);
+    }
+
+    /**
+     * clear
+     * Preconditions: none
+     * Postconditions: no IDs are given out
+     */
+    void clear() {
+        objects.clear();
+    }
+};
@@ -0,0 +1,148 @@
+#include "InputSource.h"
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+/*
+ * @file InputSource.cpp
+ * @author Katarina McGaughy
+ * InputSource gives read only access to the whole contents of an
+ * input file as one string_view. Regular files are memory mapped and
+ * marked for sequential access so nothing is copied, anything that can
+ * not be mapped (pipes, other platforms) is read into a buffer instead.
+ *
+ * Features:
+ * -memory map a file
+ * -fall back to buffered reads
+ * -hand out the contents as a string_view
+ *
+ * Assumptions:
+ * -the file is not changed while the InputSource is open
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#if defined(_WIN32)
+
+ /**
+  * @brief Construct a new InputSource object
+  * opens the file at path and reads it into the buffer
+  * @param path : file to open
+  */
+InputSource::InputSource(const string& path) {
+    ifstream in(path, ios::binary);
+    if (!in) {
+        return;
+    }
+    opened = true;
+    in.seekg(0, ios::end);
+    buffer.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0, ios::beg);
+    in.read(buffer.data(), buffer.size());
+    data = buffer.data();
+    length = static_cast<size_t>(in.gcount());
+}
+
+/**
+ * @brief Destroy the InputSource object
+ */
+InputSource::~InputSource() {}
+
+#else
+
+/**
+ * @brief Construct a new InputSource object
+ * opens the file at path and maps or reads it
+ * @param path : file to open
+ */
+InputSource::InputSource(const string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    opened = true;
+    struct stat info;
+    //only regular files can be mapped, pipes are read
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size),
+            PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            madvise(mapped, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+            mapping = mapped;
+            data = static_cast<const char*>(mapped);
+            length = static_cast<size_t>(info.st_size);
+        }
+    }
+    if (mapping == nullptr) {
+        readAll(fd);
+    }
+    ::close(fd);
+}
+
+/**
+ * readAll
+ * this function reads the whole file descriptor into buffer
+ * Preconditions: fd must be open for reading
+ * Postconditions: buffer holds the contents
+ * @param fd : file descriptor to read
+ */
+void InputSource::readAll(int fd) {
+    size_t used = 0;
+    buffer.resize(1 << 16);
+    while (true) {
+        if (used == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        ssize_t got = ::read(fd, buffer.data() + used, buffer.size() - used);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            break;
+        }
+        used += static_cast<size_t>(got);
+    }
+    data = buffer.data();
+    length = used;
+}
+
+/**
+ * @brief Destroy the InputSource object
+ * unmaps the file
+ */
+InputSource::~InputSource() {
+    if (mapping != nullptr) {
+        munmap(mapping, length);
+        mapping = nullptr;
+    }
+}
+
+#endif
+
+/**
+ * isOpen
+ * Preconditions: none
+ * Postconditions: returns true if the file could be opened
+ */
+bool InputSource::isOpen() const {
+    return opened;
+}
+
+/**
+ * getData
+ * Preconditions: none
+ * Postconditions: returns the contents of the file, the view is
+ * valid as long as the InputSource is
+ */
+string_view InputSource::getData() const {
+    return string_view(data, length);
+}
@@ -0,0 +1,81 @@
+#pragma once
+/*
+ * @file InputSource.h
+ * @author Katarina McGaughy
+ * InputSource gives read only access to the whole contents of an
+ * input file as one string_view. Regular files are memory mapped and
+ * marked for sequential access so nothing is copied, anything that can
+ * not be mapped (pipes, other platforms) is read into a buffer instead.
+ *
+ * Features:
+ * -memory map a file
+ * -fall back to buffered reads
+ * -hand out the contents as a string_view
+ *
+ * Assumptions:
+ * -the file is not changed while the InputSource is open
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <string>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+class InputSource
+{
+private:
+    const char* data = nullptr;     // start of the contents
+    size_t length = 0;              // number of bytes in the contents
+    void* mapping = nullptr;        // memory mapping, nullptr if buffered
+    vector<char> buffer;            // contents when the file is not mapped
+    bool opened = false;
+
+#if !defined(_WIN32)
+    /**
+     * readAll
+     * this function reads the whole file descriptor into buffer
+     * Preconditions: fd must be open for reading
+     * Postconditions: buffer holds the contents
+     * @param fd : file descriptor to read
+     */
+    void readAll(int fd);
+#endif
+
+public:
+
+    /**
+     * @brief Construct a new InputSource object
+     * opens the file at path and maps or reads it
+     * @param path : file to open
+     */
+    InputSource(const string& path);
+
+    /**
+     * @brief Destroy the InputSource object
+     * unmaps the file
+     */
+    ~InputSource();
+
+    InputSource(const InputSource&) = delete;
+    InputSource& operator=(const InputSource&) = delete;
+
+    /**
+     * isOpen
+     * Preconditions: none
+     * Postconditions: returns true if the file could be opened
+     */
+    bool isOpen() const;
+
+    /**
+     * getData
+     * Preconditions: none
+     * Postconditions: returns the contents of the file, the view is
+     * valid as long as the InputSource is
+     */
+    string_view getData() const;
+};
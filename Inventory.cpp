@@ -1,4 +1,6 @@
 #include "Inventory.h"
+#include <algorithm>
+#include <thread>
 /*
  * @file Inventory.h
  * @author Katarina McGaughy
@@ -9,6 +11,7 @@
  * Features:
  * -display Collectibles
  * -build Collectible lists
+ * -compare and diff Inventory snapshots
  *
  * @version 0.1
  * @date 2022-2-21
@@ -19,51 +22,160 @@
 
 
  /**
-  * buildSortedList
-  * this function takes in an array of Collectible pointers
-  * and builds a sorted vector of them
-  * Preconditons: inventory array must be initialized
-  * Postconditions: orderedInventoryList is updated
-  * @param inventory : vector of Collectible arrays
+  * staticLess
+  * this function returns an ordering of Comparables that are all of
+  * type T, the comparison is called directly instead of through the
+  * vtable so the sort can inline it
   */
-void Inventory::buildSortedList(vector<Object*>& inventory)
+template <class T>
+static auto staticLess() {
+    return [](const Comparable* a, const Comparable* b) {
+        return static_cast<const T*>(a)->T::operator<(*b);
+    };
+}
+
+/**
+ * buildSortedList
+ * this function sorts the Collectibles in items on several
+ * threads and bulk builds the ordered lists
+ * Preconditons: none
+ * Postconditions: orderedInventoryList is updated
+ * @param threads : number of threads to sort with
+ */
+void Inventory::buildSortedList(int threads)
+{
+    vector<vector<Comparable*>> buckets(CollectibleRegistry::numTypes);
+    for (size_t i = 0; i < items.size(); i++) {
+        buckets[items[i].index()].push_back(&asCollectible(items[i]));
+    }
+
+    CollectibleRegistry::forEachType([&](auto index) {
+        using T = CollectibleRegistry::TypeAt<decltype(index)::value>;
+        parallelSort(buckets[index], threads, staticLess<T>());
+        orderedInventoryList[index]->buildSorted(buckets[index]);
+    });
+}
+
+/**
+ * parallelSort
+ * this function stable sorts items by splitting them into one
+ * run per thread, sorting the runs at the same time and merging
+ * neighbouring runs in parallel rounds
+ * Preconditons: none
+ * Postconditions: items is sorted, equal items keep their order
+ * @param items : Collectibles to sort
+ * @param threads : number of threads to sort with
+ * @param less : ordering of the Collectibles
+ */
+template <class Less>
+void Inventory::parallelSort(vector<Comparable*>& items, int threads, Less less)
 {
-    for (int i = 0; i < inventory.size(); i++) {
-        Collectible* col = dynamic_cast<Collectible*>(inventory[i]);
-        //int numItems = 0;
-            if (col->getType() == "M") {
-                //numItems = col->getCount();
-                //while (numItems > 0) {
-                    orderedCoins->insert(col);
-                   // numItems--;
-               // }
-            }
-            else if (col->getType() == "S") {
-                orderedSportsCards->insert(col);
-            }
-            else if (col->getType() == "C") {
-                orderedComicBooks->insert(col);
-            }
-        else {
-            cout << "Invalid Inventory item. Will not add to inventory." << endl;
+    size_t runs = min(static_cast<size_t>(max(threads, 1)), items.size());
+    if (runs < 2) {
+        stable_sort(items.begin(), items.end(), less);
+        return;
+    }
+    vector<size_t> bounds(runs + 1);
+    for (size_t r = 0; r <= runs; r++) {
+        bounds[r] = items.size() * r / runs;
+    }
+
+    vector<thread> workers;
+    for (size_t r = 0; r < runs; r++) {
+        workers.emplace_back([&items, &bounds, &less, r]() {
+            stable_sort(items.begin() + bounds[r], items.begin() + bounds[r + 1], less);
+        });
+    }
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+
+    //merge neighbouring runs, each round halves the number of runs
+    for (size_t width = 1; width < runs; width *= 2) {
+        workers.clear();
+        for (size_t r = 0; r + width < runs; r += 2 * width) {
+            size_t low = bounds[r];
+            size_t mid = bounds[r + width];
+            size_t high = bounds[min(r + 2 * width, runs)];
+            workers.emplace_back([&items, &less, low, mid, high]() {
+                inplace_merge(items.begin() + low, items.begin() + mid,
+                    items.begin() + high, less);
+            });
+        }
+        for (size_t i = 0; i < workers.size(); i++) {
+            workers[i].join();
         }
     }
+}
 
-    orderedInventoryList.push_back(orderedCoins);
-    orderedInventoryList.push_back(orderedComicBooks);
-    orderedInventoryList.push_back(orderedSportsCards);
+/**
+ * getOrderedList
+ * this function returns the ordered list that holds
+ * Collectibles of the same type as col
+ * Preconditions: none
+ * Postconditions: returns the SearchTree or nullptr if the
+ * type is not recognized
+ * @param col : Collectible
+ */
+SearchTree* Inventory::getOrderedList(Collectible* col) const
+{
+    int index = CollectibleRegistry::indexOf(col->getPackedKey().tag);
+    if (index < 0) {
+        return nullptr;
+    }
+    return orderedInventoryList[index];
+}
 
+/**
+ * getColumnStore
+ * this function returns the ColumnStore that holds
+ * Collectibles of the same type as col
+ * Preconditions: none
+ * Postconditions: returns the ColumnStore or nullptr if the
+ * type is not recognized
+ * @param col : Collectible
+ */
+ColumnStore* Inventory::getColumnStore(Collectible* col)
+{
+    int index = CollectibleRegistry::indexOf(col->getPackedKey().tag);
+    if (index < 0) {
+        return nullptr;
+    }
+    return &columnStores[index];
 }
 
+/**
+ * buildColumns
+ * this function copies the Collectibles of tree into columns
+ * in sorted order and gives each Collectible its row
+ * Preconditions: none
+ * Postconditions: columns holds the Collectibles of tree
+ * @param tree : ordered list of one type
+ * @param columns : ColumnStore of the same type
+ */
+void Inventory::buildColumns(const SearchTree* tree, ColumnStore& columns)
+{
+    columns.clear();
+    vector<Comparable*> items = tree->traverseInOrder();
+    for (size_t i = 0; i < items.size(); i++) {
+        Collectible* col = static_cast<Collectible*>(items[i]);
+        col->setRow(columns.append(col->getColumns()));
+    }
+}
 
 /**
  * @brief Construct a new Inventory object
  *
  */
 Inventory::Inventory() {
-    orderedCoins = new SearchTree();
-    orderedComicBooks = new SearchTree();
-    orderedSportsCards = new SearchTree();
+    //one ordered list per registered type, the Collectibles
+    //are stored in items
+    for (size_t i = 0; i < CollectibleRegistry::numTypes; i++) {
+        SearchTree* tree = new SearchTree();
+        tree->setOwnsData(false);
+        orderedInventoryList.push_back(tree);
+    }
+    columnStores = CollectibleRegistry::makeColumnStores();
 }
 
 /**
@@ -72,7 +184,7 @@ Inventory::Inventory() {
  */
 Inventory::~Inventory() {
 
-    for (int i = 0; i < orderedInventoryList.size(); i++) {
+    for (size_t i = 0; i < orderedInventoryList.size(); i++) {
         if (orderedInventoryList[i] != nullptr) {
             delete orderedInventoryList[i];
         }
@@ -80,29 +192,46 @@ Inventory::~Inventory() {
 
     orderedInventoryList.clear();
 
-    //set pointers to nullptr
-    orderedCoins = nullptr;
-    orderedSportsCards = nullptr;
-    orderedComicBooks = nullptr;
-
     
 }
 
 /**
  * buildInventory
- * this function takes in a vector of Collectible pointers and a
- * vector of key strings and calls the buildSortedList function
- * as well as builds HashTable of Collectibles for quick access
- * Precondtions: both vectors must be initialized
+ * this function takes the Collectibles in values, sorts them
+ * into the ordered lists and builds the HashTable of Collectibles
+ * for quick access, the Inventory keeps the values
+ * Precondtions: none
  * Postconditons: the HashTable of Collectibles is built along
- * with a sorted vector of Collectibles
- * @param col : vector of Collectibles
- * @param keys : vector of keys
+ * with a sorted list of each type of Collectible
+ * @param values : Collectibles of the inventory
+ * @param threads : number of threads to sort with
  */
-void Inventory::buildInventory(vector<Object*> col, vector<string> keys)
+void Inventory::buildInventory(vector<CollectibleValue>&& values, int threads)
 {
-    buildSortedList(col); //via SearchTree
-    inventoryList.build(col, keys); // create Hashtable of customers
+    //the ordered lists and the IdTable point into items so it
+    //must not grow after this
+    items = move(values);
+    vector<string> keys;
+    vector<uint64_t> hashes;
+    itemIds.clear();
+    itemIds.reserve(items.size());
+    keys.reserve(items.size());
+    hashes.reserve(items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        Collectible& item = asCollectible(items[i]);
+        item.setId(itemIds.add(&item));
+        keys.push_back(item.getKey());
+        hashes.push_back(item.getFingerprint());
+    }
+    buildSortedList(threads); //sorted and bulk built
+    inventoryList.build(move(keys), hashes); // create Hashtable of Collectible IDs
+    totalCount = 0;
+    for (size_t i = 0; i < orderedInventoryList.size(); i++) {
+        buildColumns(orderedInventoryList[i], columnStores[i]);
+        for (int row = 0; row < columnStores[i].size(); row++) {
+            totalCount += columnStores[i].getCount(row);
+        }
+    }
 
 }
 
@@ -116,10 +245,37 @@ Postconditions: Inventory is printed out in order
 */
 void Inventory::displayInventory() const
 {
-    for (int i = 0; i < orderedInventoryList.size(); i++) {
-        orderedInventoryList[i]->print();
+    for (size_t i = 0; i < columnStores.size(); i++) {
+        columnStores[i].display();
+    }
+}
+
+/*
+displayLowStock
+this function displays the Collectibles whose count is at
+or below threshold in the same order as displayInventory
+Preconditions: none
+Postconditions: the matching Collectibles are printed
+*/
+void Inventory::displayLowStock(int threshold) const
+{
+    for (size_t i = 0; i < columnStores.size(); i++) {
+        columnStores[i].displayLowStock(threshold);
     }
+}
 
+/*
+displayYears
+this function displays the Collectibles made from year from
+to year to in the same order as displayInventory
+Preconditions: none
+Postconditions: the matching Collectibles are printed
+*/
+void Inventory::displayYears(int from, int to) const
+{
+    for (size_t i = 0; i < columnStores.size(); i++) {
+        columnStores[i].displayYears(from, to);
+    }
 }
 
 /*
@@ -130,9 +286,82 @@ Preconditions: none
 Postconditions: Collectible pointer is returned for item
 that matches desc
 */
-Object* Inventory::getCollectible(string desc) const {
-   return inventoryList.getValue(desc);
+Object* Inventory::getCollectible(const string& desc) const {
+   return itemIds.get(inventoryList.getId(desc));
 
 }
 
+/*
+getIds
+this function returns the table that finds a Collectible
+by its ID
+Preconditions: none
+Postconditions: returns the IdTable of the Collectibles
+*/
+const IdTable<Collectible>& Inventory::getIds() const {
+    return itemIds;
+}
 
+/*
+updateCount
+this function sets the inventory count of col to count and
+updates the ordered list that holds col
+Preconditions: col must be in the Inventory
+Postconditions: count of col is updated
+*/
+void Inventory::updateCount(Collectible* col, int count) {
+    totalCount += count - col->getCount();
+    col->setCount(count);
+    ColumnStore* columns = getColumnStore(col);
+    if (columns != nullptr && col->getRow() >= 0) {
+        columns->setCount(col->getRow(), count);
+    }
+    SearchTree* tree = getOrderedList(col);
+    if (tree != nullptr) {
+        tree->refresh(*col);
+    }
+}
+
+/*
+getTotalCount
+this function returns how many units of every Collectible are
+in the store, it is kept up to date by updateCount
+Preconditions: none
+Postconditions: returns the number of units
+*/
+long Inventory::getTotalCount() const {
+    return totalCount;
+}
+
+/*
+operator==
+this function returns true if both Inventories hold the same
+Collectibles with the same counts
+Preconditions: none
+Postconditions: returns true if the Inventories are the same
+*/
+bool Inventory::operator==(const Inventory& rhs) const {
+    for (size_t i = 0; i < orderedInventoryList.size(); i++) {
+        if (*orderedInventoryList[i] != *rhs.orderedInventoryList[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+diff
+this function returns the Collectibles that differ between
+this Inventory and rhs, skipping the parts that are the same
+Preconditions: none
+Postconditions: returns the Collectibles that differ
+*/
+vector<const Comparable*> Inventory::diff(const Inventory& rhs) const {
+    vector<const Comparable*> changed;
+    for (size_t i = 0; i < orderedInventoryList.size(); i++) {
+        vector<const Comparable*> typeChanged =
+            orderedInventoryList[i]->diff(*rhs.orderedInventoryList[i]);
+        changed.insert(changed.end(), typeChanged.begin(), typeChanged.end());
+    }
+    return changed;
+}
@@ -9,6 +9,11 @@
  * Features:
  * -display Collectibles
  * -build Collectible lists
+ * -compare and diff Inventory snapshots
+ * -stores every Collectible by value
+ * -columnar copy of each type for scans
+ * -low stock and year range reports
+ * -dense ID for every Collectible
  *
  * @version 0.1
  * @date 2022-2-21
@@ -19,29 +24,81 @@
 
 #include "Object.h"
 #include "HashTable.h"
+#include "IdTable.h"
 #include "Collectible.h"
 #include "SearchTree.h"
+#include "ColumnStore.h"
+#include "CollectibleValue.h"
+#include "CollectibleRegistry.h"
 
 class Inventory : public Object
 {
 
 private:
 
-    HashTable inventoryList;  // to have access for customer transactions
-    SearchTree* orderedCoins = nullptr;
-    SearchTree* orderedSportsCards = nullptr;
-    SearchTree* orderedComicBooks = nullptr;
-    vector<SearchTree*> orderedInventoryList;
+    vector<CollectibleValue> items;  // every Collectible of the inventory
+    HashTable inventoryList;  // ID of each Collectible by key, for customer transactions
+    IdTable<Collectible> itemIds;   // Collectible of each ID, the ID is its index in items
+    vector<SearchTree*> orderedInventoryList;   // one per registered type
+    vector<ColumnStore> columnStores;           // one per registered type, sorted
+    long totalCount = 0;                        // units of every Collectible in the store
 
     /**
      * buildSortedList
-     * this function takes in an array of Collectible pointers
-     * and builds a sorted vector of them
-     * Preconditons: inventory array must be initialized
+     * this function sorts the Collectibles in items on several
+     * threads and bulk builds the ordered lists
+     * Preconditons: none
      * Postconditions: orderedInventoryList is updated
-     * @param inventory : vector of Collectible arrays
+     * @param threads : number of threads to sort with
      */
-    void buildSortedList(vector<Object*>& inventory);
+    void buildSortedList(int threads);
+
+    /**
+     * parallelSort
+     * this function stable sorts items by splitting them into one
+     * run per thread, sorting the runs at the same time and merging
+     * neighbouring runs in parallel rounds
+     * Preconditons: none
+     * Postconditions: items is sorted, equal items keep their order
+     * @param items : Collectibles to sort
+     * @param threads : number of threads to sort with
+     * @param less : ordering of the Collectibles
+     */
+    template <class Less>
+    static void parallelSort(vector<Comparable*>& items, int threads, Less less);
+
+    /**
+     * getOrderedList
+     * this function returns the ordered list that holds
+     * Collectibles of the same type as col
+     * Preconditions: none
+     * Postconditions: returns the SearchTree or nullptr if the
+     * type is not recognized
+     * @param col : Collectible
+     */
+    SearchTree* getOrderedList(Collectible* col) const;
+
+    /**
+     * getColumnStore
+     * this function returns the ColumnStore that holds
+     * Collectibles of the same type as col
+     * Preconditions: none
+     * Postconditions: returns the ColumnStore or nullptr if the
+     * type is not recognized
+     * @param col : Collectible
+     */
+    ColumnStore* getColumnStore(Collectible* col);
+
+    /**
+     * buildColumns
+     * this function copies the Collectibles of tree into columns
+     * in sorted order and gives each Collectible its row
+     * Preconditions: none
+     * Postconditions: columns holds the Collectibles of tree
+     * @param tree : ordered list of one type
+     * @param columns : ColumnStore of the same type
+     */
+    static void buildColumns(const SearchTree* tree, ColumnStore& columns);
 
 public:
 
@@ -59,16 +116,16 @@ public:
 
     /**
      * buildInventory
-     * this function takes in a vector of Collectible pointers and a
-     * vector of key strings and calls the buildSortedList function
-     * as well as builds HashTable of Collectibles for quick access
-     * Precondtions: both vectors must be initialized
+     * this function takes the Collectibles in values, sorts them
+     * into the ordered lists and builds the HashTable of Collectibles
+     * for quick access, the Inventory keeps the values
+     * Precondtions: none
      * Postconditons: the HashTable of Collectibles is built along
-     * with a sorted vector of Collectibles
-     * @param col : vector of Collectibles
-     * @param keys : vector of keys
+     * with a sorted list of each type of Collectible
+     * @param values : Collectibles of the inventory
+     * @param threads : number of threads to sort with
      */
-    void buildInventory(vector<Object*> col, vector<string> keys);
+    void buildInventory(vector<CollectibleValue>&& values, int threads = 1);
 
     /*
     displayInventory
@@ -89,7 +146,70 @@ public:
    Postconditions: Collectible pointer is returned for item
    that matches desc
    */
-    Object* getCollectible(string desc) const;
+    Object* getCollectible(const string& desc) const;
+
+    /*
+    getIds
+    this function returns the table that finds a Collectible
+    by its ID
+    Preconditions: none
+    Postconditions: returns the IdTable of the Collectibles
+    */
+    const IdTable<Collectible>& getIds() const;
+
+    /*
+    updateCount
+    this function sets the inventory count of col to count and
+    updates the ordered list that holds col
+    Preconditions: col must be in the Inventory
+    Postconditions: count of col is updated
+    */
+    void updateCount(Collectible* col, int count);
+
+    /*
+    getTotalCount
+    this function returns how many units of every Collectible are
+    in the store, it is kept up to date by updateCount
+    Preconditions: none
+    Postconditions: returns the number of units
+    */
+    long getTotalCount() const;
+
+    /*
+    displayLowStock
+    this function displays the Collectibles whose count is at
+    or below threshold in the same order as displayInventory
+    Preconditions: none
+    Postconditions: the matching Collectibles are printed
+    */
+    void displayLowStock(int threshold) const;
+
+    /*
+    displayYears
+    this function displays the Collectibles made from year from
+    to year to in the same order as displayInventory
+    Preconditions: none
+    Postconditions: the matching Collectibles are printed
+    */
+    void displayYears(int from, int to) const;
+
+    /*
+    operator==
+    this function returns true if both Inventories hold the same
+    Collectibles with the same counts
+    Preconditions: none
+    Postconditions: returns true if the Inventories are the same
+    */
+    bool operator==(const Inventory& rhs) const;
+
+    /*
+    diff
+    this function returns the Collectibles that differ between
+    this Inventory and rhs, skipping the parts that are the same
+    Preconditions: none
+    Postconditions: returns the Collectibles that differ
+    */
+    vector<const Comparable*> diff(const Inventory& rhs) const;
 };
 
 
@@ -8,6 +8,7 @@
  * Features:
  * -read in string
  * -create Collectible
+ * -report records that are not valid
  *
  * Assumptions:
  * -string is in correct format
@@ -28,17 +29,71 @@
   * @param desc
   * @return Collectible*
   */
-Collectible* InventoryFactory::createCollectible(string desc) {
-    if (desc[0] == 'M') {
-        return new Coin(desc);
-    }
-    if (desc[0] == 'C') {
-        return new ComicBook(desc);
+Collectible* InventoryFactory::createCollectible(string_view desc) {
+    FieldTokenizer fields(desc);
+    return createCollectible(fields);
+}
+
+/**
+ * @brief Create a Collectible object
+ * from a record that is already being split
+ *
+ * @param fields : tokenizer positioned at the first field
+ * @param report : print a message if the record is not valid
+ * @return Collectible* : nullptr if the record is not valid
+ */
+Collectible* InventoryFactory::createCollectible(FieldTokenizer& fields, bool report) {
+    ParseError error;
+    Collectible* col = CollectibleRegistry::create(fields, error);
+    if (col == nullptr && report) {
+        reportInvalid(fields.getLine(), error);
     }
-    if (desc[0] == 'S') {
-        return new SportsCard(desc);
+    return col;
+}
+
+/**
+ * @brief Create a Collectible value
+ * from a record that is already being split, the Collectible
+ * is constructed in value instead of on the heap
+ *
+ * @param fields : tokenizer positioned at the first field
+ * @param value : set to the new Collectible
+ * @param report : print a message if the record is not valid
+ * @return ParseError::None : if value holds the new Collectible
+ */
+ParseError InventoryFactory::createValue(FieldTokenizer& fields, CollectibleValue& value, bool report) {
+    ParseError error = CollectibleRegistry::parse(fields, value);
+    if (error != ParseError::None && report) {
+        reportInvalid(fields.getLine(), error);
     }
+    return error;
+}
+
+/**
+ * reportUnrecognized
+ * this function prints that desc is not a recognized Collectible
+ *
+ * @param desc : description that could not be created
+ */
+void InventoryFactory::reportUnrecognized(string_view desc) const {
     cout << "Collectible: ";
     cout << desc << " is not recognized. Try again." << endl;
-    return nullptr;
+}
+
+/**
+ * reportInvalid
+ * this function prints why desc could not be created, empty
+ * records are skipped without a message
+ *
+ * @param desc : description that could not be created
+ * @param error : why it could not be created
+ */
+void InventoryFactory::reportInvalid(string_view desc, ParseError error) const {
+    if (error == ParseError::UnknownType) {
+        reportUnrecognized(desc);
+    }
+    else if (error != ParseError::None && error != ParseError::EmptyRecord) {
+        cout << "Collectible: " << desc << " has a ";
+        cout << ParseStats::describe(error) << ". Try again." << endl;
+    }
 }
\ No newline at end of file
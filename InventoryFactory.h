@@ -4,10 +4,12 @@
  * InventoryFactory creates the following Collectible items based
  * on the string that is read in:
  * Coin, CommicBook, SportsCard
+ * and any other type in the CollectibleRegistry
  *
  * Features:
  * -read in string
  * -create Collectible
+ * -report records that are not valid
  *
  * Assumptions:
  * -string is in correct format
@@ -24,6 +26,9 @@
 #include "Coin.h"
 #include "ComicBook.h"
 #include "SportsCard.h"
+#include "FieldTokenizer.h"
+#include "CollectibleValue.h"
+#include "CollectibleRegistry.h"
 
 
 class InventoryFactory {
@@ -35,5 +40,45 @@ public:
      * @param desc
      * @return Collectible*
      */
-    Collectible* createCollectible(string desc);
+    Collectible* createCollectible(string_view desc);
+
+    /**
+     * @brief Create a Collectible object
+     * from a record that is already being split
+     *
+     * @param fields : tokenizer positioned at the first field
+     * @param report : print a message if the record is not valid
+     * @return Collectible* : nullptr if the record is not valid
+     */
+    Collectible* createCollectible(FieldTokenizer& fields, bool report = true);
+
+    /**
+     * @brief Create a Collectible value
+     * from a record that is already being split, the Collectible
+     * is constructed in value instead of on the heap
+     *
+     * @param fields : tokenizer positioned at the first field
+     * @param value : set to the new Collectible
+     * @param report : print a message if the record is not valid
+     * @return ParseError::None : if value holds the new Collectible
+     */
+    ParseError createValue(FieldTokenizer& fields, CollectibleValue& value, bool report = true);
+
+    /**
+     * reportUnrecognized
+     * this function prints that desc is not a recognized Collectible
+     *
+     * @param desc : description that could not be created
+     */
+    void reportUnrecognized(string_view desc) const;
+
+    /**
+     * reportInvalid
+     * this function prints why desc could not be created, empty
+     * records are skipped without a message
+     *
+     * @param desc : description that could not be created
+     * @param error : why it could not be created
+     */
+    void reportInvalid(string_view desc, ParseError error) const;
 };
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "CollectibleStore.h"
+#include "TestCheck.h"
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <cstdio>
+/*
+ * @file LoadTest.cpp
+ * @author Katarina McGaughy
+ * LoadTest checks that loading an inventory on several threads prints
+ * exactly what loading it on one thread prints, including the records
+ * that are rejected.
+ *
+ * Build and run from the source directory, also with -fsanitize=thread:
+ * g++ -std=c++17 -pthread LoadTest.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o LoadTest
+ * ./LoadTest
+ *
+ * Features:
+ * -an inventory big enough to be split into four chunks
+ * -valid, repeated and rejected records in every chunk
+ * -names that are new to every chunk so the threads intern at once
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+static const char* inventoryFile = "loadtest_inventory.txt";
+
+/**
+ * writeInventory
+ * this function writes records until the file is larger than bytes,
+ * the same every time it is called
+ * @param bytes : size the file grows to
+ */
+static void writeInventory(size_t bytes) {
+    const char* names[] = { "Lincoln Cent", "Liberty Nickel", "Morgan Dollar" };
+    const char* grades[] = { "Mint", "Near Mint", "Good" };
+    const char* titles[] = { "Superman", "X-Men", "Batman" };
+    const char* players[] = { "Mickey Mantle", "Babe Ruth", "Hank Aaron" };
+    mt19937 random(2022);
+    ofstream out(inventoryFile, ios::binary);
+    size_t written = 0;
+    for (long i = 0; written < bytes; i++) {
+        string line;
+        int year = 1900 + static_cast<int>(random() % 40);
+        switch (random() % 8) {
+        case 0:
+        case 1:
+        case 2:
+            line = "M, 2, " + to_string(year) + ", " + to_string(random() % 70) +
+                ", " + names[random() % 3] + " " + to_string(random() % 20000);
+            break;
+        case 3:
+        case 4:
+            line = string("C, 1, ") + to_string(year) + ", " + grades[random() % 3] +
+                ", " + titles[random() % 3] + " " + to_string(random() % 20000) + ", DC";
+            break;
+        case 5:
+        case 6:
+            line = string("S, 3, ") + to_string(year) + ", " + grades[random() % 3] +
+                ", " + players[random() % 3] + " " + to_string(random() % 20000) +
+                ", Topps";
+            break;
+        default:
+            //rejected for a bad number, a missing field or the type
+            const char* bad[] = { "M, x, 1913, 70, Liberty Nickel", "C, 1, 1938",
+                "Q, 1, 2, 3, 4", "" };
+            line = bad[i % 4];
+            break;
+        }
+        out << line << '\n';
+        written += line.size() + 1;
+    }
+}
+
+/**
+ * load
+ * this function loads the inventory with threads load threads
+ * @param threads : number of threads to load with
+ * @return everything the store printed
+ */
+static string load(int threads) {
+    ostringstream printed;
+    streambuf* old = cout.rdbuf(printed.rdbuf());
+    {
+        CollectibleStore store;
+        store.setLoadThreads(threads);
+        InputSource inventory(inventoryFile);
+        store.initializeInventory(inventory);
+    }
+    cout.rdbuf(old);
+    return printed.str();
+}
+
+int main() {
+    //four chunks of at least the smallest chunk the store splits
+    writeInventory(5 << 20);
+    //the symbols stay interned, so the threads load first to
+    //intern every name at the same time
+    string four = load(4);
+    string one = load(1);
+    remove(inventoryFile);
+    CHECK(one.size() > (1 << 20));
+    CHECK(one == four);
+    return TestCheck::report("LoadTest");
+}
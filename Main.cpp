@@ -27,14 +27,22 @@
 int main() {
 
 	CollectibleStore* store = new CollectibleStore();
-	ifstream inventoryFile("hw4inventory.txt");
+	store->setQuarantineFile("hw4quarantine.txt");
+	//keep the newest 1000 transactions of each customer in memory
+	//once the journal reaches a million rows, the rest go to a
+	//scratch file that is removed when the store is deleted
+	CompactionPolicy compaction;
+	compaction.maxRows = 1 << 20;
+	compaction.keepLast = 1000;
+	store->setCompaction(compaction, "hw4history.seg");
+	InputSource inventoryFile("hw4inventory.txt");
 	store->initializeInventory(inventoryFile);
 	cout << endl;
-	ifstream customerFile("hw4customers.txt");
+	InputSource customerFile("hw4customers.txt");
 	store->initializeCustomers(customerFile);
 	cout << endl;
 	cout << "Executing commands: " << endl;
-	ifstream commandFile("hw4commands.txt");
+	InputSource commandFile("hw4commands.txt");
 	store->getCommands(commandFile);
 	delete store;
 
@@ -0,0 +1,171 @@
+#include "NameTrie.h"
+#include "Customer.h"
+#include <algorithm>
+/*
+ * @file NameTrie.cpp
+ * @author Katarina McGaughy
+ * NameTrie indexes customers by the letters of their name so they can
+ * be found by the start of their name in any case. The nodes live in
+ * one vector and point to their first child and next sibling by index,
+ * siblings are kept in letter order so a search returns names in
+ * alphabetical order. Customers with the same name are kept at the
+ * same node in the order they were added.
+ *
+ * Features:
+ * -add a customer
+ * -find every customer whose name starts with a prefix
+ *
+ * Assumptions:
+ * -names are compared without case, other characters as they are
+ * -the Customers outlive the NameTrie
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * @brief Construct a new NameTrie object
+  * with only the root
+  */
+NameTrie::NameTrie() {
+    nodes.emplace_back();
+}
+
+/**
+ * fold
+ * Preconditions: none
+ * Postconditions: returns c in lower case
+ * @param c : character of a name
+ */
+char NameTrie::fold(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+/**
+ * findChild
+ * Preconditions: node must be a node of the trie
+ * Postconditions: returns the child of node with letter, -1 if
+ * it has none
+ * @param node : index of the parent
+ * @param letter : letter of the child
+ */
+int NameTrie::findChild(int node, char letter) const {
+    int child = nodes[node].firstChild;
+    //siblings are in letter order so the search stops early
+    while (child >= 0 && static_cast<unsigned char>(nodes[child].letter) <
+        static_cast<unsigned char>(letter)) {
+        child = nodes[child].nextSibling;
+    }
+    return (child >= 0 && nodes[child].letter == letter) ? child : -1;
+}
+
+/**
+ * addChild
+ * this function returns the child of node with letter and adds
+ * it in letter order if it does not exist
+ * Preconditions: node must be a node of the trie
+ * Postconditions: node has a child with letter
+ * @param node : index of the parent
+ * @param letter : letter of the child
+ */
+int NameTrie::addChild(int node, char letter) {
+    int previous = -1;
+    int child = nodes[node].firstChild;
+    while (child >= 0 && static_cast<unsigned char>(nodes[child].letter) <
+        static_cast<unsigned char>(letter)) {
+        previous = child;
+        child = nodes[child].nextSibling;
+    }
+    if (child >= 0 && nodes[child].letter == letter) {
+        return child;
+    }
+    int added = static_cast<int>(nodes.size());
+    Node newNode;
+    newNode.letter = letter;
+    newNode.nextSibling = child;
+    nodes.push_back(newNode);
+    if (previous < 0) {
+        nodes[node].firstChild = added;
+    }
+    else {
+        nodes[previous].nextSibling = added;
+    }
+    return added;
+}
+
+/**
+ * insert
+ * this function adds customer under the letters of its name
+ * Preconditions: customer must not be nullptr
+ * Postconditions: customer is found by every prefix of its name
+ * @param customer : customer to add
+ */
+void NameTrie::insert(Customer* customer) {
+    const string& name = customer->getName();
+    int node = 0;
+    for (size_t i = 0; i < name.size(); i++) {
+        node = addChild(node, fold(name[i]));
+    }
+    int entry = static_cast<int>(entries.size());
+    entries.push_back({ customer, -1 });
+    if (nodes[node].lastCustomer < 0) {
+        nodes[node].firstCustomer = entry;
+    }
+    else {
+        entries[nodes[node].lastCustomer].next = entry;
+    }
+    nodes[node].lastCustomer = entry;
+}
+
+/**
+ * findPrefix
+ * this function finds every customer whose name starts with
+ * prefix in any case, it walks the prefix and then only the
+ * part of the trie under it
+ * Preconditions: none
+ * Postconditions: returns the customers in alphabetical order
+ * @param prefix : start of the name
+ */
+vector<Customer*> NameTrie::findPrefix(string_view prefix) const {
+    vector<Customer*> found;
+    int node = 0;
+    for (size_t i = 0; i < prefix.size() && node >= 0; i++) {
+        node = findChild(node, fold(prefix[i]));
+    }
+    if (node < 0) {
+        return found;
+    }
+    //depth first in letter order, a node's own customers come
+    //before the longer names under it
+    vector<int> stack;
+    stack.push_back(node);
+    while (!stack.empty()) {
+        int current = stack.back();
+        stack.pop_back();
+        for (int e = nodes[current].firstCustomer; e >= 0; e = entries[e].next) {
+            found.push_back(entries[e].customer);
+        }
+        //push the children last letter first so the first is visited first
+        size_t mark = stack.size();
+        for (int child = nodes[current].firstChild; child >= 0;
+            child = nodes[child].nextSibling) {
+            stack.push_back(child);
+        }
+        reverse(stack.begin() + mark, stack.end());
+    }
+    return found;
+}
+
+/**
+ * clear
+ * Preconditions: none
+ * Postconditions: the trie only has the root
+ */
+void NameTrie::clear() {
+    nodes.clear();
+    entries.clear();
+    nodes.emplace_back();
+}
@@ -0,0 +1,125 @@
+#pragma once
+/*
+ * @file NameTrie.h
+ * @author Katarina McGaughy
+ * NameTrie indexes customers by the letters of their name so they can
+ * be found by the start of their name in any case. The nodes live in
+ * one vector and point to their first child and next sibling by index,
+ * siblings are kept in letter order so a search returns names in
+ * alphabetical order. Customers with the same name are kept at the
+ * same node in the order they were added.
+ *
+ * Features:
+ * -add a customer
+ * -find every customer whose name starts with a prefix
+ *
+ * Assumptions:
+ * -names are compared without case, other characters as they are
+ * -the Customers outlive the NameTrie
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <vector>
+#include <string_view>
+using namespace std;
+
+class Customer;
+
+class NameTrie
+{
+private:
+    /**
+     * Node struct holds one letter of a name, the indexes of its
+     * first child and next sibling and the customers whose name
+     * ends at it
+     */
+    struct Node
+    {
+        char letter = 0;
+        int firstChild = -1;
+        int nextSibling = -1;
+        int firstCustomer = -1;     // index in entries, -1 if none
+        int lastCustomer = -1;      // index in entries, -1 if none
+    };
+
+    /**
+     * Entry struct holds a customer and the index of the next
+     * customer with the same name
+     */
+    struct Entry
+    {
+        Customer* customer = nullptr;
+        int next = -1;
+    };
+
+    vector<Node> nodes;     // nodes[0] is the root
+    vector<Entry> entries;  // customers of every node
+
+    /**
+     * fold
+     * Preconditions: none
+     * Postconditions: returns c in lower case
+     * @param c : character of a name
+     */
+    static char fold(char c);
+
+    /**
+     * findChild
+     * Preconditions: node must be a node of the trie
+     * Postconditions: returns the child of node with letter, -1 if
+     * it has none
+     * @param node : index of the parent
+     * @param letter : letter of the child
+     */
+    int findChild(int node, char letter) const;
+
+    /**
+     * addChild
+     * this function returns the child of node with letter and adds
+     * it in letter order if it does not exist
+     * Preconditions: node must be a node of the trie
+     * Postconditions: node has a child with letter
+     * @param node : index of the parent
+     * @param letter : letter of the child
+     */
+    int addChild(int node, char letter);
+
+public:
+
+    /**
+     * @brief Construct a new NameTrie object
+     * with only the root
+     */
+    NameTrie();
+
+    /**
+     * insert
+     * this function adds customer under the letters of its name
+     * Preconditions: customer must not be nullptr
+     * Postconditions: customer is found by every prefix of its name
+     * @param customer : customer to add
+     */
+    void insert(Customer* customer);
+
+    /**
+     * findPrefix
+     * this function finds every customer whose name starts with
+     * prefix in any case, it walks the prefix and then only the
+     * part of the trie under it
+     * Preconditions: none
+     * Postconditions: returns the customers in alphabetical order
+     * @param prefix : start of the name
+     */
+    vector<Customer*> findPrefix(string_view prefix) const;
+
+    /**
+     * clear
+     * Preconditions: none
+     * Postconditions: the trie only has the root
+     */
+    void clear();
+};
@@ -0,0 +1,79 @@
+#include "NameTrie.h"
+#include "Customer.h"
+#include "TestCheck.h"
+/*
+ * @file NameTrieTest.cpp
+ * @author Katarina McGaughy
+ * NameTrieTest checks that NameTrie finds customers by the start of
+ * their name in any case and returns them in alphabetical order.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -pthread NameTrieTest.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o NameTrieTest
+ * ./NameTrieTest
+ *
+ * Features:
+ * -prefixes in any case, the whole name and the empty prefix
+ * -customers with the same name in the order they were added
+ * -prefixes that match nothing
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * names
+  * Preconditions: none
+  * Postconditions: returns the IDs of found joined with spaces
+  * @param found : customers found by the trie
+  */
+static string names(const vector<Customer*>& found) {
+    string out;
+    for (size_t i = 0; i < found.size(); i++) {
+        out.append(i == 0 ? "" : " ").append(found[i]->getCustomerID());
+    }
+    return out;
+}
+
+/**
+ * testPrefix
+ * every prefix finds the customers whose name starts with it
+ */
+static void testPrefix() {
+    Customer donald("456, Donald Duck");
+    Customer daisy("123, Daisy Duck");
+    Customer mickey("789, Mickey Mouse");
+    Customer minnie("321, Minnie Mouse");
+    Customer otherDonald("654, donald duck");
+    Customer don("111, Don");
+    NameTrie trie;
+    trie.insert(&donald);
+    trie.insert(&mickey);
+    trie.insert(&daisy);
+    trie.insert(&minnie);
+    trie.insert(&otherDonald);
+    trie.insert(&don);
+
+    CHECK(names(trie.findPrefix("M")) == "789 321");
+    CHECK(names(trie.findPrefix("mi")) == "789 321");
+    CHECK(names(trie.findPrefix("Mic")) == "789");
+    CHECK(names(trie.findPrefix("D")) == "123 111 456 654");
+    CHECK(names(trie.findPrefix("DONALD DUCK")) == "456 654");
+    CHECK(names(trie.findPrefix("Don")) == "111 456 654");
+    CHECK(names(trie.findPrefix("")) == "123 111 456 654 789 321");
+    CHECK(trie.findPrefix("Goofy").empty());
+    CHECK(trie.findPrefix("Donald Ducks").empty());
+    CHECK(trie.findPrefix("x").empty());
+
+    trie.clear();
+    CHECK(trie.findPrefix("").empty());
+    trie.insert(&minnie);
+    CHECK(names(trie.findPrefix("m")) == "321");
+}
+
+int main() {
+    testPrefix();
+    return TestCheck::report("NameTrieTest");
+}
@@ -0,0 +1,97 @@
+#pragma once
+/*
+ * @file PackedKey.h
+ * @author Katarina McGaughy
+ * PackedKey is the binary form of the key of a Collectible. The fields
+ * that identify an item are packed into two 64 bit integers so two
+ * items are equal when the integers are equal, and the first 8 bytes
+ * of the field the item is sorted by first are stored big endian so
+ * most orderings are decided by one integer compare.
+ *
+ * Features:
+ * -compare two keys for equality
+ * -build an order preserving prefix of a string
+ * -pack two 32 bit values into one integer
+ * -keep the order of signed years and grades when they are packed
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <string_view>
+#include <cstdint>
+using namespace std;
+
+struct PackedKey
+{
+    char tag = 0;           // type of the Collectible (M, C, S)
+    uint64_t prefix = 0;    // first 8 bytes of the first sort field
+    uint64_t high = 0;      // packed identity of the named fields
+    uint64_t low = 0;       // packed identity of the numeric fields
+
+    /**
+     * makePrefix
+     * this function packs the first 8 bytes of text big endian so
+     * the integers order the same way the strings do, shorter text
+     * is padded with zeros
+     * Preconditions: none
+     * Postconditions: returns the prefix of text
+     * @param text : string to pack
+     */
+    static uint64_t makePrefix(string_view text) {
+        uint64_t prefix = 0;
+        for (size_t i = 0; i < 8; i++) {
+            prefix <<= 8;
+            if (i < text.size()) {
+                prefix |= static_cast<unsigned char>(text[i]);
+            }
+        }
+        return prefix;
+    }
+
+    /**
+     * bias
+     * this function flips the sign bit of value so the unsigned
+     * result orders the same way the signed values do
+     * Preconditions: none
+     * Postconditions: returns value with its sign bit flipped
+     * @param value : signed year or grade
+     */
+    static uint32_t bias(int value) {
+        return static_cast<uint32_t>(value) ^ 0x80000000u;
+    }
+
+    /**
+     * pack
+     * Preconditions: none
+     * Postconditions: returns first in the high half and second in
+     * the low half of one integer
+     * @param first : value compared first
+     * @param second : value compared second
+     */
+    static uint64_t pack(uint32_t first, uint32_t second) {
+        return (static_cast<uint64_t>(first) << 32) | second;
+    }
+
+    /**
+     * operator==
+     * Preconditions: none
+     * Postconditions: returns true if both keys identify the same item
+     * @param rhs : key to compare to
+     */
+    bool operator==(const PackedKey& rhs) const {
+        return high == rhs.high && low == rhs.low && tag == rhs.tag;
+    }
+
+    /**
+     * operator!=
+     * Preconditions: none
+     * Postconditions: returns true if the keys identify different items
+     * @param rhs : key to compare to
+     */
+    bool operator!=(const PackedKey& rhs) const {
+        return !operator==(rhs);
+    }
+};
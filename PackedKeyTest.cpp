@@ -0,0 +1,110 @@
+#include "PackedKey.h"
+#include "Coin.h"
+#include "TestCheck.h"
+/*
+ * @file PackedKeyTest.cpp
+ * @author Katarina McGaughy
+ * PackedKeyTest checks that packed keys order and compare the same way
+ * as the fields they are built from.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 PackedKeyTest.cpp Coin.cpp Comparable.cpp FieldTokenizer.cpp ParseResult.cpp SymbolTable.cpp -o PackedKeyTest
+ * ./PackedKeyTest
+ *
+ * Features:
+ * -prefixes order like the strings
+ * -negative years and grades order before positive ones
+ * -two parses of one record have the same key
+ * -names that share the prefix order like the strings
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * testPrefix
+  * prefixes order the same way as the strings they are built from
+  */
+static void testPrefix() {
+    CHECK(PackedKey::makePrefix("") == 0);
+    CHECK(PackedKey::makePrefix("A") < PackedKey::makePrefix("AB"));
+    CHECK(PackedKey::makePrefix("Abc") < PackedKey::makePrefix("Abd"));
+    CHECK(PackedKey::makePrefix("Z") < PackedKey::makePrefix("a"));
+    CHECK(PackedKey::makePrefix("Lincoln Cent") == PackedKey::makePrefix("Lincoln C"));
+    //bytes above 127 sort after ASCII like they do in a string
+    CHECK(PackedKey::makePrefix("z") < PackedKey::makePrefix("\xC3\xA9"));
+}
+
+/**
+ * testBias
+ * packed signed values keep their order across zero
+ */
+static void testBias() {
+    const int values[] = { INT32_MIN, -2000, -1, 0, 1, 1913, INT32_MAX };
+    bool ordered = true;
+    for (size_t i = 1; i < sizeof(values) / sizeof(values[0]); i++) {
+        ordered = ordered && PackedKey::bias(values[i - 1]) < PackedKey::bias(values[i]);
+    }
+    CHECK(ordered);
+    CHECK(PackedKey::pack(PackedKey::bias(-5), PackedKey::bias(70)) <
+        PackedKey::pack(PackedKey::bias(5), PackedKey::bias(1)));
+    CHECK(PackedKey::pack(PackedKey::bias(5), PackedKey::bias(-1)) <
+        PackedKey::pack(PackedKey::bias(5), PackedKey::bias(0)));
+}
+
+/**
+ * testCoin
+ * Coins with negative years and grades sort before positive ones and
+ * two parses of one record have equal keys
+ */
+static void testCoin() {
+    FieldTokenizer older("M, 1, -50, 10, Denarius");
+    FieldTokenizer newer("M, 1, 20, 10, Denarius");
+    FieldTokenizer worse("M, 1, 20, -3, Denarius");
+    Coin a;
+    Coin b;
+    Coin c;
+    CHECK(a.parse(older) == ParseError::None);
+    CHECK(b.parse(newer) == ParseError::None);
+    CHECK(c.parse(worse) == ParseError::None);
+    CHECK(a < b);
+    CHECK(!(b < a));
+    CHECK(c < b);
+    CHECK(a.getKey() == "M, -50, 10, Denarius");
+
+    FieldTokenizer again("M, 7, -50, 10,   Denarius");
+    Coin d;
+    d.parse(again);
+    CHECK(d.getPackedKey() == a.getPackedKey());
+    CHECK(d.getPackedKey() != b.getPackedKey());
+    CHECK(d.getFingerprint() == a.getFingerprint());
+}
+
+/**
+ * testSharedPrefix
+ * Coins whose types share the first 8 bytes order like the types,
+ * not like the ids the types were interned with
+ */
+static void testSharedPrefix() {
+    FieldTokenizer nickel("M, 1, 1913, 70, Liberty Nickel");
+    FieldTokenizer head("M, 1, 1913, 70, Liberty Head");
+    Coin a;
+    Coin b;
+    a.parse(nickel);
+    b.parse(head);
+    CHECK(a.getPackedKey().prefix == b.getPackedKey().prefix);
+    CHECK(b < a);
+    CHECK(!(a < b));
+    CHECK(!(a < a));
+}
+
+int main() {
+    testPrefix();
+    testBias();
+    testCoin();
+    testSharedPrefix();
+    return TestCheck::report("PackedKeyTest");
+}
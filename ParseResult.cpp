@@ -0,0 +1,116 @@
+#include "ParseResult.h"
+/*
+ * @file ParseResult.cpp
+ * @author Katarina McGaughy
+ * ParseError is what the record parsers return instead of throwing, so
+ * a bad line costs no more than a good one and the load keeps going.
+ * ParseStats counts the bad records of a load by kind of error and
+ * prints a one line summary of them at the end.
+ *
+ * Features:
+ * -name the ways a record can be bad
+ * -count bad records by kind
+ * -merge counts from several threads
+ * -print a summary
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * record
+  * this function counts one record that failed with error
+  * Preconditions: none
+  * Postconditions: the count of error is one higher
+  * @param error : why the record failed
+  */
+void ParseStats::record(ParseError error) {
+    counts[static_cast<int>(error)]++;
+}
+
+/**
+ * merge
+ * this function adds the counts of other to these counts
+ * Preconditions: none
+ * Postconditions: counts holds both sets of counts
+ * @param other : counts to add
+ */
+void ParseStats::merge(const ParseStats& other) {
+    for (int i = 0; i < numErrors; i++) {
+        counts[i] += other.counts[i];
+    }
+}
+
+/**
+ * getCount
+ * Preconditions: none
+ * Postconditions: returns the number of records that failed
+ * with error
+ * @param error : kind of error
+ */
+size_t ParseStats::getCount(ParseError error) const {
+    return counts[static_cast<int>(error)];
+}
+
+/**
+ * total
+ * Preconditions: none
+ * Postconditions: returns the number of records that failed
+ */
+size_t ParseStats::total() const {
+    size_t sum = 0;
+    for (int i = 1; i < numErrors; i++) {
+        sum += counts[i];
+    }
+    return sum;
+}
+
+/**
+ * describe
+ * Preconditions: none
+ * Postconditions: returns a short description of error
+ * @param error : kind of error
+ */
+const char* ParseStats::describe(ParseError error) {
+    switch (error) {
+    case ParseError::None:
+        return "valid";
+    case ParseError::EmptyRecord:
+        return "empty";
+    case ParseError::UnknownType:
+        return "unknown type";
+    case ParseError::MissingField:
+        return "missing field";
+    case ParseError::BadNumber:
+        return "bad number";
+    }
+    return "unknown error";
+}
+
+/**
+ * report
+ * this function prints how many records of what were skipped
+ * and the count of every kind of error, nothing is printed if
+ * no record failed
+ * Preconditions: none
+ * Postconditions: the summary is printed
+ * @param what : name of the records (inventory, customer)
+ */
+void ParseStats::report(const string& what) const {
+    if (total() == 0) {
+        return;
+    }
+    cout << "Skipped " << total() << " bad " << what << " records:";
+    bool first = true;
+    for (int i = 1; i < numErrors; i++) {
+        if (counts[i] > 0) {
+            cout << (first ? " " : ", ") << counts[i] << " "
+                << describe(static_cast<ParseError>(i));
+            first = false;
+        }
+    }
+    cout << endl;
+}
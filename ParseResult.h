@@ -0,0 +1,99 @@
+#pragma once
+/*
+ * @file ParseResult.h
+ * @author Katarina McGaughy
+ * ParseError is what the record parsers return instead of throwing, so
+ * a bad line costs no more than a good one and the load keeps going.
+ * ParseStats counts the bad records of a load by kind of error and
+ * prints a one line summary of them at the end.
+ *
+ * Features:
+ * -name the ways a record can be bad
+ * -count bad records by kind
+ * -merge counts from several threads
+ * -print a summary
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <array>
+#include <string>
+#include <iostream>
+using namespace std;
+
+/**
+ * ParseError names why a record could not be parsed
+ */
+enum class ParseError
+{
+    None,           // the record is valid
+    EmptyRecord,    // the line has nothing on it
+    UnknownType,    // no Collectible type has the tag of the record
+    MissingField,   // the record ends before a required field
+    BadNumber       // a number field is not a whole number
+};
+
+class ParseStats
+{
+private:
+    static const int numErrors = 5;
+    array<size_t, numErrors> counts{};  // bad records of each ParseError
+
+public:
+
+    /**
+     * record
+     * this function counts one record that failed with error
+     * Preconditions: none
+     * Postconditions: the count of error is one higher
+     * @param error : why the record failed
+     */
+    void record(ParseError error);
+
+    /**
+     * merge
+     * this function adds the counts of other to these counts
+     * Preconditions: none
+     * Postconditions: counts holds both sets of counts
+     * @param other : counts to add
+     */
+    void merge(const ParseStats& other);
+
+    /**
+     * getCount
+     * Preconditions: none
+     * Postconditions: returns the number of records that failed
+     * with error
+     * @param error : kind of error
+     */
+    size_t getCount(ParseError error) const;
+
+    /**
+     * total
+     * Preconditions: none
+     * Postconditions: returns the number of records that failed
+     */
+    size_t total() const;
+
+    /**
+     * describe
+     * Preconditions: none
+     * Postconditions: returns a short description of error
+     * @param error : kind of error
+     */
+    static const char* describe(ParseError error);
+
+    /**
+     * report
+     * this function prints how many records of what were skipped
+     * and the count of every kind of error, nothing is printed if
+     * no record failed
+     * Preconditions: none
+     * Postconditions: the summary is printed
+     * @param what : name of the records (inventory, customer)
+     */
+    void report(const string& what) const;
+};
@@ -0,0 +1,90 @@
+#include "ParseResult.h"
+#include "InventoryFactory.h"
+#include "TestCheck.h"
+#include <sstream>
+/*
+ * @file ParseResultTest.cpp
+ * @author Katarina McGaughy
+ * ParseResultTest checks that bad inventory records are rejected with
+ * the right ParseError and that ParseStats counts and reports them.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -pthread ParseResultTest.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o ParseResultTest
+ * ./ParseResultTest
+ *
+ * Features:
+ * -the error of every kind of bad record
+ * -valid records of every type
+ * -counting, merging and reporting errors
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * parse
+  * this function creates a CollectibleValue from record without
+  * printing anything
+  * @param record : inventory record
+  * @return the error of the record
+  */
+static ParseError parse(string_view record) {
+    InventoryFactory factory;
+    FieldTokenizer fields(record);
+    CollectibleValue value;
+    return factory.createValue(fields, value, false);
+}
+
+/**
+ * testRecords
+ * every kind of bad record gets its own error
+ */
+static void testRecords() {
+    CHECK(parse("M, 3, 2001, 65, Lincoln Cent") == ParseError::None);
+    CHECK(parse("C, 1, 1938, Mint, Superman, DC") == ParseError::None);
+    CHECK(parse("S, 2, 1989, Near Mint, Ken Griffey Jr, Upper Deck") == ParseError::None);
+    CHECK(parse("") == ParseError::EmptyRecord);
+    CHECK(parse("Q, 1, 2001, 65, Lincoln Cent") == ParseError::UnknownType);
+    CHECK(parse("M, 3, 2001, 65") == ParseError::MissingField);
+    CHECK(parse("C, 1, 1938, Mint, , DC") == ParseError::MissingField);
+    CHECK(parse("S, 2, 1989") == ParseError::MissingField);
+    CHECK(parse("M, three, 2001, 65, Lincoln Cent") == ParseError::BadNumber);
+    CHECK(parse("C, 1, 19x8, Mint, Superman, DC") == ParseError::BadNumber);
+    CHECK(parse("M, 3, 2001, 6.5, Lincoln Cent") == ParseError::BadNumber);
+}
+
+/**
+ * testStats
+ * errors are counted by kind, merged and reported in one line
+ */
+static void testStats() {
+    ParseStats stats;
+    CHECK(stats.total() == 0);
+    stats.record(ParseError::BadNumber);
+    stats.record(ParseError::BadNumber);
+    stats.record(ParseError::UnknownType);
+    ParseStats other;
+    other.record(ParseError::MissingField);
+    stats.merge(other);
+    CHECK(stats.total() == 4);
+    CHECK(stats.getCount(ParseError::BadNumber) == 2);
+    CHECK(stats.getCount(ParseError::MissingField) == 1);
+    CHECK(stats.getCount(ParseError::EmptyRecord) == 0);
+
+    ostringstream printed;
+    streambuf* old = cout.rdbuf(printed.rdbuf());
+    stats.report("inventory");
+    ParseStats().report("customer");
+    cout.rdbuf(old);
+    CHECK(printed.str() == "Skipped 4 bad inventory records: 1 unknown type, "
+        "1 missing field, 2 bad number\n");
+}
+
+int main() {
+    testRecords();
+    testStats();
+    return TestCheck::report("ParseResultTest");
+}
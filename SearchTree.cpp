@@ -10,7 +10,10 @@
  * -store Comparables in a BST
  * -copy constructor
  * -assignment operator
- * -equality and inequality operator overload
+ * -equality and inequality operator overload in O(1) via subtree hashes
+ * -diff against another tree that skips identical subtrees
+ * -bulk build a balanced tree from sorted data
+ * -stays balanced (AVL) on insert and remove so both are O(log n)
  * -insert, delete, retrieve, get the height and depth of a node, and delete all contents
  * of BST
  * -output stream (frequency of character and characters inorder)
@@ -28,6 +31,7 @@
  */
 #include "SearchTree.h"
 # include <cassert>
+#include <algorithm>
 using namespace std;
 
 /**
@@ -86,8 +90,9 @@ const SearchTree& SearchTree::operator=(const SearchTree& rhs) {
 		this->makeEmpty();
 		//assign number of nodes 
 		this->numberOfNodes = rhs.numberOfNodes;
-		//copy tree
+		//copy tree, the copies belong to this tree
 		copyHelper(rhs.root_, this->root_);
+		ownsData = true;
 	}
 	return *this;
 }
@@ -105,10 +110,10 @@ void SearchTree::copyHelper(Node* copyRoot, Node*& thisRoot) const{
 
 	if (copyRoot != nullptr) {
 		thisRoot = new Node();
-		//thisRoot->data = new Comparable; 
-		thisRoot->data = thisRoot->data->copy(*copyRoot->data);
-		//*thisRoot->data = *copyRoot->data;
+		thisRoot->data = copyRoot->data->copy(*copyRoot->data);
 		thisRoot->count = copyRoot->count;
+		thisRoot->hash = copyRoot->hash;
+		thisRoot->height = copyRoot->height;
 		copyHelper(copyRoot->leftChild, thisRoot->leftChild);
 		copyHelper(copyRoot->rightChild, thisRoot->rightChild);
 	}
@@ -119,21 +124,55 @@ void SearchTree::copyHelper(Node* copyRoot, Node*& thisRoot) const{
 
 /**
  * operator==
- * this function calls compareToHelper and returns true if compareToHelper
- * returns true
+ * this function returns true if the trees have the same number of
+ * nodes and the same root hash, it takes O(1) and trusts the hash,
+ * sameNodes checks the trees node by node
  * Preconditions: none
  * Postconditios: returns true if the trees are the same and false or else
  * @param rhs: right hand side search tree
  * @return: returns true if the trees are the same and false or else
  */
 bool SearchTree::operator==(const SearchTree& rhs) const {
-	return comparingHelper(rhs.root_, this->root_);
+	//the hash does not depend on the shape so trees built in a
+	//different order are still equal
+	return numberOfNodes == rhs.numberOfNodes &&
+		subtreeHash(root_) == subtreeHash(rhs.root_);
+}
+
+/**
+ * sameNodes
+ * this function compares the trees node by node in order, it takes
+ * O(n) and is used to check what operator== trusts the hash for
+ * Preconditions: none
+ * Postconditios: returns true if both trees hold the same data with
+ * the same counts, a hash collision is never the same
+ * @param rhs: right hand side search tree
+ * @return: returns true if the trees are the same and false or else
+ */
+bool SearchTree::sameNodes(const SearchTree& rhs) const {
+	//the shapes can differ so the nodes are compared in order
+	vector<const Node*> thisNodes;
+	vector<const Node*> otherNodes;
+	collectNodes(root_, thisNodes);
+	collectNodes(rhs.root_, otherNodes);
+	if (thisNodes.size() != otherNodes.size()) {
+		return false;
+	}
+	for (size_t i = 0; i < thisNodes.size(); i++) {
+		const Node* a = thisNodes[i];
+		const Node* b = otherNodes[i];
+		if (*a->data != *b->data || a->count != b->count ||
+			a->data->hashCode() != b->data->hashCode()) {
+			return false;
+		}
+	}
+	return true;
 }
 
 /**
  * operator!=
- * this function calls compareToHelper and returns true if compareToHelper
- * returns false
+ * this function returns true if the trees do not hold the same data
+ * with the same counts
  * Preconditions: none
  * Postconditios: returns true if they are not the same tree and
  * false if they are
@@ -142,45 +181,278 @@ bool SearchTree::operator==(const SearchTree& rhs) const {
  * false if they are
  */
 bool SearchTree::operator!=(const SearchTree& rhs) const {
-	return !comparingHelper(rhs.root_, this->root_);
+	return !operator==(rhs);
+}
+
+/**
+ * subtreeHash
+ * this function returns the subtree hash of root or 0 if root is nullptr
+ * Preconditions: none
+ * Postconditios: returns the hash of the subtree
+ * @param root: pointer to root of subtree
+ * @return: hash of the subtree
+ */
+size_t SearchTree::subtreeHash(const Node* root) {
+	return root == nullptr ? 0 : root->hash;
 }
 
+/**
+ * updateHash
+ * this function recomputes the hash of root from its data, count and
+ * the hashes of its children. the hash is the sum of the mixed hash of
+ * every node so equal contents hash the same regardless of tree shape
+ * Preconditions: children hashes must be up to date
+ * Postconditios: root->hash is up to date
+ * @param root: pointer to root of subtree
+ */
+void SearchTree::updateHash(Node* root) {
+	if (root == nullptr) {
+		return;
+	}
+	//mix the node hash so the sum does not cancel out
+	uint64_t h = root->data->hashCode() +
+		static_cast<uint64_t>(root->count) * 0x9e3779b97f4a7c15ULL;
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+	h = h ^ (h >> 31);
+	root->hash = static_cast<size_t>(h) + subtreeHash(root->leftChild) +
+		subtreeHash(root->rightChild);
+}
 
 /**
- * comparingHelper
- * this is a recursive function that compares two search trees
- * and returns true if they are the same and false if they are not
+ * subtreeHeight
+ * this function returns the height of root or 0 if root is nullptr
  * Preconditions: none
- * Postconditios: returns true if they are the same and false if they are not
- * @param otherRoot: pointer to root of this SearchTree
- * @param thisRoot: pointer to root of other SearchTree
- * @return: returns true if they are the same and false if they are not
+ * Postconditios: returns the height of the subtree
+ * @param root: pointer to root of subtree
+ * @return: height of the subtree
  */
-bool SearchTree::comparingHelper(Node* otherRoot, Node* thisRoot) const {
-	//if both roots are nullptr return true 
-	if (otherRoot == nullptr && thisRoot == nullptr) {
-		return true;
+int SearchTree::subtreeHeight(const Node* root) {
+	return root == nullptr ? 0 : root->height;
+}
+
+/**
+ * updateNode
+ * this function recomputes the height and hash of root from its
+ * children
+ * Preconditions: root can not be nullptr, children must be up to date
+ * Postconditios: root->height and root->hash are up to date
+ * @param root: pointer to root of subtree
+ */
+void SearchTree::updateNode(Node* root) {
+	root->height = 1 + max(subtreeHeight(root->leftChild),
+		subtreeHeight(root->rightChild));
+	updateHash(root);
+}
+
+/**
+ * rotateLeft
+ * this function makes the right child of root the new root of
+ * the subtree
+ * Preconditions: root and its right child can not be nullptr
+ * Postconditios: the subtree keeps its order and root points to
+ * the new root
+ * @param root: pointer to root of subtree
+ */
+void SearchTree::rotateLeft(Node*& root) {
+	Node* pivot = root->rightChild;
+	root->rightChild = pivot->leftChild;
+	updateNode(root);
+	pivot->leftChild = root;
+	updateNode(pivot);
+	root = pivot;
+}
+
+/**
+ * rotateRight
+ * this function makes the left child of root the new root of
+ * the subtree
+ * Preconditions: root and its left child can not be nullptr
+ * Postconditios: the subtree keeps its order and root points to
+ * the new root
+ * @param root: pointer to root of subtree
+ */
+void SearchTree::rotateRight(Node*& root) {
+	Node* pivot = root->leftChild;
+	root->leftChild = pivot->rightChild;
+	updateNode(root);
+	pivot->rightChild = root;
+	updateNode(pivot);
+	root = pivot;
+}
+
+/**
+ * rebalance
+ * this function rotates root if the heights of its children differ
+ * by more than one and updates its height and hash
+ * Preconditions: both children must be balanced and up to date
+ * Postconditios: the subtree is balanced and up to date
+ * @param root: pointer to root of subtree
+ */
+void SearchTree::rebalance(Node*& root) {
+	if (root == nullptr) {
+		return;
 	}
-	//if roots are not the same then retuen false 
-	else if (otherRoot == nullptr && thisRoot != nullptr) {
-		return false;
+	int balance = subtreeHeight(root->leftChild) - subtreeHeight(root->rightChild);
+	//left heavy, rotate the left child first if it leans right
+	if (balance > 1) {
+		Node* left = root->leftChild;
+		if (subtreeHeight(left->leftChild) < subtreeHeight(left->rightChild)) {
+			rotateLeft(root->leftChild);
+		}
+		rotateRight(root);
+	}
+	//right heavy, rotate the right child first if it leans left
+	else if (balance < -1) {
+		Node* right = root->rightChild;
+		if (subtreeHeight(right->rightChild) < subtreeHeight(right->leftChild)) {
+			rotateRight(root->rightChild);
+		}
+		rotateLeft(root);
 	}
-	else if (otherRoot != nullptr && thisRoot == nullptr) {
+	else {
+		updateNode(root);
+	}
+}
+
+/**
+ * refresh
+ * this function recomputes the hashes on the path to data, it must be
+ * called after data is changed in a way that changes its hashCode
+ * Preconditions: none
+ * Postconditios: returns true if data was found and hashes are updated
+ * @param data: Comparable whose hash changed
+ * @return: true if data was found in the tree
+ */
+bool SearchTree::refresh(const Comparable& data) {
+	return refreshHelper(root_, data);
+}
+
+/**
+ * refreshHelper
+ * this is a recursive function that finds the node with data and
+ * recomputes the hashes on the path back up to the root
+ * Preconditions: none
+ * Postconditios: returns true if data was found
+ * @param root: pointer to root of SearchTree
+ * @param data: Comparable whose hash changed
+ * @return: true if data was found
+ */
+bool SearchTree::refreshHelper(Node* root, const Comparable& data) {
+	if (root == nullptr) {
 		return false;
 	}
-	//if both roots are not nullptr 
+	bool found = false;
+	int order = data.compare(*root->data);
+	if (order == 0) {
+		found = true;
+	}
+	else if (order < 0) {
+		found = refreshHelper(root->leftChild, data);
+	}
 	else {
-		//return true if the data and count are the same for the nodes
-		if (*otherRoot->data == *thisRoot->data &&
-			otherRoot->count == thisRoot->count &&
-			comparingHelper(otherRoot->leftChild, thisRoot->leftChild) &&
-			comparingHelper(otherRoot->rightChild, thisRoot->rightChild)) {
-			return true;
+		found = refreshHelper(root->rightChild, data);
+	}
+	if (found) {
+		updateHash(root);
+	}
+	return found;
+}
+
+/**
+ * diff
+ * this function returns the data that differs between this tree and rhs,
+ * data in both trees with different contents or counts is returned from
+ * this tree and data only in one of the trees is returned from that tree.
+ * identical subtrees are skipped
+ * Preconditions: none
+ * Postconditios: returns the data that differs
+ * @param rhs: right hand side search tree
+ * @return: vector of the data that differs
+ */
+vector<const Comparable*> SearchTree::diff(const SearchTree& rhs) const {
+	vector<const Comparable*> changed;
+	diffHelper(root_, rhs.root_, changed);
+	return changed;
+}
+
+/**
+ * diffHelper
+ * this is a recursive function that adds the data that differs between
+ * two subtrees to changed. subtrees with the same hash are skipped and
+ * subtrees with the same root data are compared child by child
+ * Preconditions: none
+ * Postconditios: changed holds the data that differs
+ * @param thisRoot: pointer to root of this SearchTree
+ * @param otherRoot: pointer to root of other SearchTree
+ * @param changed: vector the differing data is added to
+ */
+void SearchTree::diffHelper(const Node* thisRoot, const Node* otherRoot,
+	vector<const Comparable*>& changed) const {
+	//identical subtrees hold the same data so skip them
+	if (subtreeHash(thisRoot) == subtreeHash(otherRoot)) {
+		return;
+	}
+	//same root data means the children split the data the same way
+	if (thisRoot != nullptr && otherRoot != nullptr &&
+		*thisRoot->data == *otherRoot->data) {
+		if (thisRoot->count != otherRoot->count ||
+			thisRoot->data->hashCode() != otherRoot->data->hashCode()) {
+			changed.push_back(thisRoot->data);
+		}
+		diffHelper(thisRoot->leftChild, otherRoot->leftChild, changed);
+		diffHelper(thisRoot->rightChild, otherRoot->rightChild, changed);
+		return;
+	}
+	//shapes differ so merge both subtrees in order
+	vector<const Node*> thisNodes;
+	vector<const Node*> otherNodes;
+	collectNodes(thisRoot, thisNodes);
+	collectNodes(otherRoot, otherNodes);
+	size_t i = 0;
+	size_t j = 0;
+	while (i < thisNodes.size() && j < otherNodes.size()) {
+		const Node* a = thisNodes[i];
+		const Node* b = otherNodes[j];
+		if (*a->data == *b->data) {
+			if (a->count != b->count ||
+				a->data->hashCode() != b->data->hashCode()) {
+				changed.push_back(a->data);
+			}
+			i++;
+			j++;
+		}
+		else if (*a->data < *b->data) {
+			changed.push_back(a->data);
+			i++;
 		}
 		else {
-			return false;
+			changed.push_back(b->data);
+			j++;
 		}
 	}
+	for (; i < thisNodes.size(); i++) {
+		changed.push_back(thisNodes[i]->data);
+	}
+	for (; j < otherNodes.size(); j++) {
+		changed.push_back(otherNodes[j]->data);
+	}
+}
+
+/**
+ * collectNodes
+ * this function stores all nodes of the subtree in inorder in nodes
+ * Preconditions: none
+ * Postconditios: nodes holds the subtree in inorder
+ * @param root: pointer to root of subtree
+ * @param nodes: vector the nodes are added to
+ */
+void SearchTree::collectNodes(const Node* root, vector<const Node*>& nodes) const {
+	if (root != nullptr) {
+		collectNodes(root->leftChild, nodes);
+		nodes.push_back(root);
+		collectNodes(root->rightChild, nodes);
+	}
 }
 
 /**
@@ -197,30 +469,16 @@ bool SearchTree::comparingHelper(Node* otherRoot, Node* thisRoot) const {
  * if the data already exists in the tree
  */
 bool SearchTree::insert(Comparable* data) {
-	//if the root_ is nullptr then create a new node with the data 
-	if (root_ == nullptr) {
-		root_ = new Node();
-		root_->data = data;
-		root_->leftChild = nullptr;
-		root_->rightChild = nullptr;
-		//increment count 
-		root_->count++;
-		this->numberOfNodes++;
-		return true;
-	}
-	//if root_ is not nullptr then call insertHelper
-	else {
-		return insertHelper(root_, data);
-	}
-
+	return insertHelper(root_, data);
 }
 
 /**
  * insertHelper
  * this is a recursive function that inserts a node in the correct place
  * in the BST if it is new data and returns true, it returns false if the data
- * already exists and increments count
- * Preconditions: root can not be nullptr
+ * already exists and increments count. the path is rebalanced and its
+ * hashes are updated
+ * Preconditions: none
  * Postconditios: returns true if the item is inserted succesfully
  * and false if the Search tree already contains data
  * @param root: pointer to root of SearchTree
@@ -229,40 +487,83 @@ bool SearchTree::insert(Comparable* data) {
  * if the data already exists in the tree
  */
 bool SearchTree::insertHelper(Node*& root, Comparable* data) {
+	//the new node goes where the search falls off the tree
+	if (root == nullptr) {
+		root = new Node();
+		root->data = data;
+		root->count++;
+		updateHash(root);
+		this->numberOfNodes++;
+		return true;
+	}
+	//one comparison decides between equal, left and right
+	int order = data->compare(*root->data);
 	//if root is data then increment count of node and return false
-	if (*root->data == *data) {
+	if (order == 0) {
 		root->count++;
+		updateHash(root);
 		return false;
 	}
-	//if data is less than the current node data then go left 
-	if (*data < *root->data) {
-		//if left child is nullptr then insert
-		if (root->leftChild == nullptr) {
-			Node* newNode = new Node;
-			newNode->data = data;
-			root->leftChild = newNode;
-			root->leftChild->count++;
-			this->numberOfNodes++;
-			return true;
+	bool inserted = order < 0 ? insertHelper(root->leftChild, data) :
+		insertHelper(root->rightChild, data);
+	rebalance(root);
+	return inserted;
+}
+
+/**
+ * buildSorted
+ * this function replaces the contents of the tree with a balanced
+ * tree of sorted. equal data that is next to each other is stored once
+ * with a count, the first one is kept like insert() does
+ * Preconditions: sorted must be in ascending order
+ * Postconditios: the tree holds the data of sorted
+ * @param sorted: data in ascending order
+ */
+void SearchTree::buildSorted(const vector<Comparable*>& sorted) {
+	makeEmpty();
+	//collapse equal data into one element with a count
+	vector<Comparable*> unique;
+	vector<int> counts;
+	unique.reserve(sorted.size());
+	counts.reserve(sorted.size());
+	for (size_t i = 0; i < sorted.size(); i++) {
+		if (!unique.empty() && *unique.back() == *sorted[i]) {
+			counts.back()++;
 		}
-		//if left child is not nullptr, then go to next left child
-		return insertHelper(root->leftChild, data);
-	}
-	//if data is greater than current root data then go left 
-	if (*data > *root->data) {
-		//if right child is nullptr then insert there 
-		if (root->rightChild == nullptr) {
-			Node* newNode = new Node;
-			newNode->data = data;
-			root->rightChild = newNode;
-			root->rightChild->count++;
-			this->numberOfNodes++;
-			return true;
+		else {
+			unique.push_back(sorted[i]);
+			counts.push_back(1);
 		}
-		//if right child is not nullptr, then go to next right child
-		return insertHelper(root->rightChild, data);
 	}
-	return false;
+	root_ = buildHelper(unique, counts, 0, static_cast<int>(unique.size()));
+	numberOfNodes = static_cast<int>(unique.size());
+}
+
+/**
+ * buildHelper
+ * this is a recursive function that builds a balanced subtree from
+ * data[low, high) with the middle element as the root
+ * Preconditions: data must be sorted with no duplicates
+ * Postconditios: returns the root of the subtree
+ * @param data: sorted data
+ * @param counts: count of each element of data
+ * @param low: first index of the subtree
+ * @param high: one past the last index of the subtree
+ * @return: root of the subtree
+ */
+SearchTree::Node* SearchTree::buildHelper(const vector<Comparable*>& data,
+	const vector<int>& counts, int low, int high) {
+	if (low >= high) {
+		return nullptr;
+	}
+	int mid = low + (high - low) / 2;
+	Node* root = new Node();
+	root->data = data[mid];
+	root->count = counts[mid];
+	root->leftChild = buildHelper(data, counts, low, mid);
+	root->rightChild = buildHelper(data, counts, mid + 1, high);
+	updateNode(root);
+	return root;
 }
 
 /**
@@ -297,22 +598,25 @@ bool SearchTree::deleteNode(Node*& root, const Comparable& data)
 {
 	if (root == nullptr)
 		return false;
+	bool deleted = true;
+	int order = data.compare(*root->data);
 	//if data is same as data at node then decrement count
-	else if (data == *root->data) {
+	if (order == 0) {
 		root->count--;
 		//if count is 0, then remove node 
 		if (root->count == 0) {
 			deleteRoot(root);
 			this->numberOfNodes--;
 		}
-		return true;
 	}
 	//if data is less than, go left
-	else if (data < *root->data)
-		return deleteNode(root->leftChild, data);
+	else if (order < 0)
+		deleted = deleteNode(root->leftChild, data);
 	//if data is greater than go right 
 	else
-		return deleteNode(root->rightChild, data);
+		deleted = deleteNode(root->rightChild, data);
+	rebalance(root);
+	return deleted;
 }
 
 /**
@@ -326,7 +630,9 @@ bool SearchTree::deleteNode(Node*& root, const Comparable& data)
  */
 void SearchTree::deleteRoot(Node*& root)
 {
-	delete root->data;
+	if (ownsData) {
+		delete root->data;
+	}
 	root->data = nullptr;
 
 	//if both children are nullptr just delete root
@@ -343,7 +649,8 @@ void SearchTree::deleteRoot(Node*& root)
 	}
 	//if node has two children 
 	else {
-		root->data = findAndDeleteMostLeft(root->rightChild);
+		root->data = findAndDeleteMostLeft(root->rightChild, root->count);
+		updateHash(root);
 	}
 }
 
@@ -354,21 +661,26 @@ void SearchTree::deleteRoot(Node*& root)
  * Preconditions: root can not be nullptr
  * Postconditios: returns the data that will replace the deleted node
  * @param root: pointer to root of SearchTree
+ * @param count: set to the count of the node that is deleted
  * @return: data of node that will replace the deleted nodes place
  */
-Comparable* SearchTree::findAndDeleteMostLeft(Node*& root)
+Comparable* SearchTree::findAndDeleteMostLeft(Node*& root, int& count)
 {
 	//if leftChild is nullptr, save data from node
 	if (root->leftChild == nullptr) {
 		Comparable* data = root->data;
+		count = root->count;
 		Node* junk = root;
 		root = root->rightChild;
 		delete junk;
 		junk = nullptr;
 		return data;
 	}
-	else
-		return findAndDeleteMostLeft(root->leftChild);
+	else {
+		Comparable* data = findAndDeleteMostLeft(root->leftChild, count);
+		rebalance(root);
+		return data;
+	}
 }
 
 /**
@@ -398,9 +710,10 @@ const Comparable* SearchTree::retrieveHelper(const Node* root, const Comparable&
 {
 	if (root == nullptr)
 		return nullptr;
-	else if (data == *root->data)
+	int order = data.compare(*root->data);
+	if (order == 0)
 		return root->data;
-	else if (data < *root->data)
+	else if (order < 0)
 		return retrieveHelper(root->leftChild, data);
 	else
 		return retrieveHelper(root->rightChild, data);
@@ -431,13 +744,27 @@ void SearchTree::makeEmptyHelper(Node*& root) {
 	if (root != nullptr) {
 		makeEmptyHelper(root->leftChild);
 		makeEmptyHelper(root->rightChild);
-		delete root->data;
+		if (ownsData) {
+			delete root->data;
+		}
 		root->data = nullptr; //set data to nullptr
 		delete root;
 		root = nullptr;
 	}
 }
 
+/**
+ * setOwnsData
+ * this function sets whether the tree deletes the Comparables it
+ * holds, a tree over data stored somewhere else must not
+ * Preconditions: none
+ * Postconditios: ownsData is owns
+ * @param owns: true if the tree deletes its data
+ */
+void SearchTree::setOwnsData(bool owns) {
+	ownsData = owns;
+}
+
 /**
 * print 
 * prints the tree in order
@@ -477,24 +804,35 @@ void SearchTree::inorderPrint(Node* root) const {
 * Postconditions: return a vector of Comparables
 */
 vector<Comparable*> SearchTree::traverseInOrder() const{
-	return createVector(root_);
+	vector<Comparable*> items;
+	createVector(root_, items);
+	return items;
+
+}
 
+/**
+* getHeight
+* Preconditions: none
+* Postconditions: returns the number of nodes on the longest path
+* from the root to a leaf, 0 for an empty tree
+*/
+int SearchTree::getHeight() const {
+	return subtreeHeight(root_);
 }
 
 /**
 * createVector
 * this function takes in a root of SearchTree and stores
-* all elements in the tree in a vector and returns the vector
+* all elements in the tree in items in inorder
 * Preconditions: none
-* Postconditions: return a vector of Comparables
+* Postconditions: items holds the Comparables of the subtree
+* @param root: pointer to root of subtree
+* @param items: vector the Comparables are added to
 */
-vector<Comparable*> SearchTree::createVector(Node* root) const {
-	vector<Comparable*> items;
+void SearchTree::createVector(Node* root, vector<Comparable*>& items) const {
 	if (root != nullptr) {
-		createVector(root->leftChild);
-		//hopefully can do this
+		createVector(root->leftChild, items);
 		items.push_back(root->data);
-		createVector(root->rightChild);
+		createVector(root->rightChild, items);
 	}
-	return items;
 }
\ No newline at end of file
@@ -10,7 +10,12 @@
  * -store Comparables in a BST
  * -copy constructor
  * -assignment operator
- * -equality and inequality operator overload
+ * -equality and inequality operator overload in O(1) from the size
+ * and the subtree hash of the root
+ * -node by node check that two trees are the same
+ * -diff against another tree that skips identical subtrees
+ * -bulk build a balanced tree from sorted data
+ * -stays balanced (AVL) on insert and remove so both are O(log n)
  * -insert, delete, retrieve, get the height and depth of a node, and delete all contents
  * of BST
  * -output stream (frequency of character and characters inorder)
@@ -52,6 +57,12 @@ private:
 
 		//count of number of times Comparable appears
 		int count = 0;
+
+		//hash of the data and count of every node in this subtree
+		size_t hash = 0;
+
+		//height of this subtree, a leaf is 1
+		int height = 1;
 	};
 
 	//pointer to root of BST
@@ -60,18 +71,133 @@ private:
 	//keeps track of the number of nodes in the BST 
 	int numberOfNodes;
 
+	//true if the data is deleted with its node
+	bool ownsData = true;
+
 
 	/**
-	 * comparingHelper
-	 * this is a recursive function that compares two search trees
-	 * and returns true if they are the same and false if they are not
+	 * subtreeHash
+	 * this function returns the subtree hash of root or 0 if root is nullptr
 	 * Preconditions: none
-	 * Postconditios: returns true if they are the same and false if they are not
-	 * @param otherRoot: pointer to root of this SearchTree
-	 * @param thisRoot: pointer to root of other SearchTree
-	 * @return: returns true if they are the same and false if they are not
+	 * Postconditios: returns the hash of the subtree
+	 * @param root: pointer to root of subtree
+	 * @return: hash of the subtree
+	 */
+	static size_t subtreeHash(const Node* root);
+
+	/**
+	 * updateHash
+	 * this function recomputes the hash of root from its data, count and
+	 * the hashes of its children. the hash is the sum of the mixed hash of
+	 * every node so equal contents hash the same regardless of tree shape
+	 * Preconditions: children hashes must be up to date
+	 * Postconditios: root->hash is up to date
+	 * @param root: pointer to root of subtree
+	 */
+	static void updateHash(Node* root);
+
+	/**
+	 * subtreeHeight
+	 * this function returns the height of root or 0 if root is nullptr
+	 * Preconditions: none
+	 * Postconditios: returns the height of the subtree
+	 * @param root: pointer to root of subtree
+	 * @return: height of the subtree
+	 */
+	static int subtreeHeight(const Node* root);
+
+	/**
+	 * updateNode
+	 * this function recomputes the height and hash of root from its
+	 * children
+	 * Preconditions: root can not be nullptr, children must be up to date
+	 * Postconditios: root->height and root->hash are up to date
+	 * @param root: pointer to root of subtree
+	 */
+	static void updateNode(Node* root);
+
+	/**
+	 * rotateLeft
+	 * this function makes the right child of root the new root of
+	 * the subtree
+	 * Preconditions: root and its right child can not be nullptr
+	 * Postconditios: the subtree keeps its order and root points to
+	 * the new root
+	 * @param root: pointer to root of subtree
+	 */
+	static void rotateLeft(Node*& root);
+
+	/**
+	 * rotateRight
+	 * this function makes the left child of root the new root of
+	 * the subtree
+	 * Preconditions: root and its left child can not be nullptr
+	 * Postconditios: the subtree keeps its order and root points to
+	 * the new root
+	 * @param root: pointer to root of subtree
+	 */
+	static void rotateRight(Node*& root);
+
+	/**
+	 * rebalance
+	 * this function rotates root if the heights of its children differ
+	 * by more than one and updates its height and hash
+	 * Preconditions: both children must be balanced and up to date
+	 * Postconditios: the subtree is balanced and up to date
+	 * @param root: pointer to root of subtree
+	 */
+	static void rebalance(Node*& root);
+
+	/**
+	 * refreshHelper
+	 * this is a recursive function that finds the node with data and
+	 * recomputes the hashes on the path back up to the root
+	 * Preconditions: none
+	 * Postconditios: returns true if data was found
+	 * @param root: pointer to root of SearchTree
+	 * @param data: Comparable whose hash changed
+	 * @return: true if data was found
+	 */
+	bool refreshHelper(Node* root, const Comparable& data);
+
+	/**
+	 * diffHelper
+	 * this is a recursive function that adds the data that differs between
+	 * two subtrees to changed. subtrees with the same hash are skipped and
+	 * subtrees with the same root data are compared child by child
+	 * Preconditions: none
+	 * Postconditios: changed holds the data that differs
+	 * @param thisRoot: pointer to root of this SearchTree
+	 * @param otherRoot: pointer to root of other SearchTree
+	 * @param changed: vector the differing data is added to
+	 */
+	void diffHelper(const Node* thisRoot, const Node* otherRoot,
+		vector<const Comparable*>& changed) const;
+
+	/**
+	 * collectNodes
+	 * this function stores all nodes of the subtree in inorder in nodes
+	 * Preconditions: none
+	 * Postconditios: nodes holds the subtree in inorder
+	 * @param root: pointer to root of subtree
+	 * @param nodes: vector the nodes are added to
 	 */
-	bool comparingHelper(Node* otherRoot, Node* thisRoot) const;
+	void collectNodes(const Node* root, vector<const Node*>& nodes) const;
+
+	/**
+	 * buildHelper
+	 * this is a recursive function that builds a balanced subtree from
+	 * data[low, high) with the middle element as the root
+	 * Preconditions: data must be sorted with no duplicates
+	 * Postconditios: returns the root of the subtree
+	 * @param data: sorted data
+	 * @param counts: count of each element of data
+	 * @param low: first index of the subtree
+	 * @param high: one past the last index of the subtree
+	 * @return: root of the subtree
+	 */
+	Node* buildHelper(const vector<Comparable*>& data, const vector<int>& counts,
+		int low, int high);
 
 	/**
 	 * copyHelper
@@ -88,8 +214,9 @@ private:
 	 * insertHelper
 	 * this is a recursive function that inserts a node in the correct place
 	 * in the BST if it is new data and returns true, it returns false if the data
-	 * already exists and increments count
-	 * Preconditions: root can not be nullptr
+	 * already exists and increments count. the path is rebalanced and its
+	 * hashes are updated
+	 * Preconditions: none
 	 * Postconditios: returns true if the item is inserted succesfully
 	 * and false if the Search tree already contains data
 	 * @param root: pointer to root of SearchTree
@@ -132,9 +259,10 @@ private:
 	 * Preconditions: root can not be nullptr
 	 * Postconditios: returns the data that will replace the deleted node
 	 * @param root: pointer to root of SearchTree
+	 * @param count: set to the count of the node that is deleted
 	 * @return: data of node that will replace the deleted nodes place
 	 */
-	Comparable* findAndDeleteMostLeft(Node*& root);
+	Comparable* findAndDeleteMostLeft(Node*& root, int& count);
 
 	/**
 	 * retrieveHelper
@@ -172,11 +300,13 @@ private:
 	/**
 	* createVector
 	* this function takes in a root of SearchTree and stores 
-	* all elements in the tree in a vector and returns the vector
+	* all elements in the tree in items in inorder
 	* Preconditions: none 
-	* Postconditions: return a vector of Comparables
+	* Postconditions: items holds the Comparables of the subtree
+	* @param root: pointer to root of subtree
+	* @param items: vector the Comparables are added to
 	*/
-	vector<Comparable*> createVector(Node* root) const;
+	void createVector(Node* root, vector<Comparable*>& items) const;
 
 
 public:
@@ -222,8 +352,9 @@ public:
 
 	/**
 	 * operator==
-	 * this function calls compareToHelper and returns true if compareToHelper
-	 * returns true
+	 * this function returns true if the trees have the same number of
+	 * nodes and the same root hash, it takes O(1) and trusts the hash,
+	 * sameNodes checks the trees node by node
 	 * Preconditions: none
 	 * Postconditios: returns true if the trees are the same and false or else
 	 * @param rhs: right hand side search tree
@@ -231,10 +362,22 @@ public:
 	 */
 	bool operator==(const SearchTree& rhs) const;
 
+	/**
+	 * sameNodes
+	 * this function compares the trees node by node in order, it takes
+	 * O(n) and is used to check what operator== trusts the hash for
+	 * Preconditions: none
+	 * Postconditios: returns true if both trees hold the same data with
+	 * the same counts, a hash collision is never the same
+	 * @param rhs: right hand side search tree
+	 * @return: returns true if the trees are the same and false or else
+	 */
+	bool sameNodes(const SearchTree& rhs) const;
+
 	/**
 	 * operator!=
-	 * this function calls compareToHelper and returns true if compareToHelper
-	 * returns false
+	 * this function returns true if the trees do not hold the same data
+	 * with the same counts
 	 * Preconditions: none
 	 * Postconditios: returns true if they are not the same tree and
 	 * false if they are
@@ -259,6 +402,17 @@ public:
 	 */
 	bool insert(Comparable* data);
 
+	/**
+	 * buildSorted
+	 * this function replaces the contents of the tree with a balanced
+	 * tree of sorted. equal data that is next to each other is stored once
+	 * with a count, the first one is kept like insert() does
+	 * Preconditions: sorted must be in ascending order
+	 * Postconditios: the tree holds the data of sorted
+	 * @param sorted: data in ascending order
+	 */
+	void buildSorted(const vector<Comparable*>& sorted);
+
 	/**
 	 * remove
 	 * this function calls deleteNode which either decrements count
@@ -283,6 +437,30 @@ public:
 	 */
 	const Comparable* retrieve(const Comparable& data) const;
 
+	/**
+	 * refresh
+	 * this function recomputes the hashes on the path to data, it must be
+	 * called after data is changed in a way that changes its hashCode
+	 * Preconditions: none
+	 * Postconditios: returns true if data was found and hashes are updated
+	 * @param data: Comparable whose hash changed
+	 * @return: true if data was found in the tree
+	 */
+	bool refresh(const Comparable& data);
+
+	/**
+	 * diff
+	 * this function returns the data that differs between this tree and rhs,
+	 * data in both trees with different contents or counts is returned from
+	 * this tree and data only in one of the trees is returned from that tree.
+	 * identical subtrees are skipped
+	 * Preconditions: none
+	 * Postconditios: returns the data that differs
+	 * @param rhs: right hand side search tree
+	 * @return: vector of the data that differs
+	 */
+	vector<const Comparable*> diff(const SearchTree& rhs) const;
+
 	/**
 	 * makeEmpty
 	 * this function calls makeEmptyHelper and deletes all nodes in
@@ -293,6 +471,16 @@ public:
 	 */
 	void makeEmpty();
 
+	/**
+	 * setOwnsData
+	 * this function sets whether the tree deletes the Comparables it
+	 * holds, a tree over data stored somewhere else must not
+	 * Preconditions: none
+	 * Postconditios: ownsData is owns
+	 * @param owns: true if the tree deletes its data
+	 */
+	void setOwnsData(bool owns);
+
 	/**
 	* print
 	* prints the tree in order
@@ -311,6 +499,14 @@ public:
 	*/
 	vector<Comparable*> traverseInOrder() const;
 
+	/**
+	* getHeight
+	* Preconditions: none
+	* Postconditions: returns the number of nodes on the longest path
+	* from the root to a leaf, 0 for an empty tree
+	*/
+	int getHeight() const;
+
 };
 
 
@@ -0,0 +1,315 @@
+#include "SearchTree.h"
+#include "TestCheck.h"
+#include <memory>
+/*
+ * @file SearchTreeTest.cpp
+ * @author Katarina McGaughy
+ * SearchTreeTest checks the subtree hashes of SearchTree: equality,
+ * diff and the bulk build, including trees whose hashes collide, and
+ * that inserts and removes keep the tree balanced.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 SearchTreeTest.cpp SearchTree.cpp Comparable.cpp -o SearchTreeTest
+ * ./SearchTreeTest
+ *
+ * Features:
+ * -equal trees of different shapes
+ * -trees with colliding hashes are told apart by sameNodes
+ * -diff of changed, added and recounted data
+ * -buildSorted against inserts
+ * -AVL balance and hashes after sorted inserts and removes
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * Num is a Comparable ordered by value, weight only changes its
+  * hashCode and collide gives every Num the same hashCode
+  */
+class Num : public Comparable
+{
+public:
+    int value = 0;
+    int weight = 0;
+    bool collide = false;
+
+    Num(int v, int w = 0, bool c = false) : value(v), weight(w), collide(c) {}
+
+    bool operator==(const Comparable& rhs) const override {
+        return value == static_cast<const Num&>(rhs).value;
+    }
+
+    bool operator!=(const Comparable& rhs) const override {
+        return !operator==(rhs);
+    }
+
+    bool operator<(const Comparable& rhs) const override {
+        return value < static_cast<const Num&>(rhs).value;
+    }
+
+    bool operator>(const Comparable& rhs) const override {
+        return value > static_cast<const Num&>(rhs).value;
+    }
+
+    void print() const override {
+        cout << value << endl;
+    }
+
+    Comparable* copy(const Comparable& c) override {
+        return new Num(static_cast<const Num&>(c));
+    }
+
+    size_t hashCode() const override {
+        return collide ? 7 : hash<int>()(value) * 31 + weight;
+    }
+};
+
+/**
+ * makeTree
+ * this function inserts nums into tree in order, the tree does not
+ * own them
+ * @param tree : tree to fill
+ * @param nums : data to insert
+ */
+static void makeTree(SearchTree& tree, vector<Num>& nums) {
+    tree.setOwnsData(false);
+    for (size_t i = 0; i < nums.size(); i++) {
+        tree.insert(&nums[i]);
+    }
+}
+
+/**
+ * testShapes
+ * trees with the same data inserted in a different order are equal
+ */
+static void testShapes() {
+    vector<Num> up;
+    vector<Num> down;
+    for (int i = 0; i < 50; i++) {
+        up.push_back(Num(i));
+        down.push_back(Num(49 - i));
+    }
+    SearchTree a;
+    SearchTree b;
+    makeTree(a, up);
+    makeTree(b, down);
+    CHECK(a == b);
+    CHECK(!(a != b));
+    CHECK(a.sameNodes(b));
+    CHECK(a.diff(b).empty());
+    SearchTree copied(a);
+    CHECK(copied == a);
+    CHECK(copied.sameNodes(a));
+}
+
+/**
+ * testCollision
+ * operator== trusts root hashes that are the same, sameNodes finds
+ * that the data is not
+ */
+static void testCollision() {
+    vector<Num> first = { Num(1, 0, true), Num(2, 0, true), Num(3, 0, true) };
+    vector<Num> second = { Num(1, 0, true), Num(2, 0, true), Num(4, 0, true) };
+    SearchTree a;
+    SearchTree b;
+    makeTree(a, first);
+    makeTree(b, second);
+    CHECK(a == b);
+    CHECK(!a.sameNodes(b));
+    CHECK(!b.sameNodes(a));
+    vector<Num> same = { Num(3, 0, true), Num(1, 0, true), Num(2, 0, true) };
+    SearchTree c;
+    makeTree(c, same);
+    CHECK(a == c);
+    CHECK(a.sameNodes(c));
+}
+
+/**
+ * testDiff
+ * diff returns the data that was added, removed or changed
+ */
+static void testDiff() {
+    vector<Num> base;
+    vector<Num> changed;
+    for (int i = 0; i < 20; i++) {
+        base.push_back(Num(i));
+        changed.push_back(Num(i, i == 7 ? 1 : 0));
+    }
+    changed.push_back(Num(30));
+    SearchTree a;
+    SearchTree b;
+    makeTree(a, base);
+    makeTree(b, changed);
+    vector<const Comparable*> found = a.diff(b);
+    CHECK(a != b);
+    CHECK(found.size() == 2);
+    bool seven = false;
+    bool thirty = false;
+    for (size_t i = 0; i < found.size(); i++) {
+        int value = static_cast<const Num*>(found[i])->value;
+        seven = seven || value == 7;
+        thirty = thirty || value == 30;
+    }
+    CHECK(seven);
+    CHECK(thirty);
+
+    //a second copy of an element only changes its count
+    Num extra(3);
+    a.insert(&extra);
+    found = a.diff(b);
+    CHECK(found.size() == 3);
+}
+
+/**
+ * testRefresh
+ * refresh updates the hashes after the data changed in place
+ */
+static void testRefresh() {
+    vector<Num> base = { Num(1), Num(2), Num(3) };
+    vector<Num> other = { Num(1), Num(2), Num(3) };
+    SearchTree a;
+    SearchTree b;
+    makeTree(a, base);
+    makeTree(b, other);
+    CHECK(a == b);
+    base[1].weight = 5;
+    CHECK(a.refresh(base[1]));
+    CHECK(a != b);
+    CHECK(a.diff(b).size() == 1);
+}
+
+/**
+ * testBuildSorted
+ * buildSorted gives the same tree as inserting one at a time and
+ * collapses repeated data into counts
+ */
+static void testBuildSorted() {
+    vector<Num> nums;
+    for (int i = 0; i < 100; i++) {
+        nums.push_back(Num(i / 2));
+    }
+    vector<Comparable*> sorted;
+    for (size_t i = 0; i < nums.size(); i++) {
+        sorted.push_back(&nums[i]);
+    }
+    SearchTree built;
+    built.setOwnsData(false);
+    built.buildSorted(sorted);
+    SearchTree inserted;
+    makeTree(inserted, nums);
+    CHECK(built == inserted);
+    CHECK(built.sameNodes(inserted));
+    vector<Comparable*> order = built.traverseInOrder();
+    CHECK(order.size() == 50);
+    bool ascending = true;
+    for (size_t i = 1; i < order.size(); i++) {
+        ascending = ascending && *order[i - 1] < *order[i];
+    }
+    CHECK(ascending);
+
+    SearchTree empty;
+    empty.buildSorted(vector<Comparable*>());
+    CHECK(empty.traverseInOrder().empty());
+    CHECK(empty != built);
+}
+
+/**
+ * maxHeight
+ * Preconditions: none
+ * Postconditions: returns the greatest height an AVL tree of n
+ * nodes can have
+ * @param n : number of nodes
+ */
+static int maxHeight(size_t n) {
+    //fewest nodes of an AVL tree of each height
+    size_t fewer = 0;
+    size_t fewest = 1;
+    int height = 1;
+    while (true) {
+        size_t next = fewest + fewer + 1;
+        if (next > n) {
+            return n == 0 ? 0 : height;
+        }
+        fewer = fewest;
+        fewest = next;
+        height++;
+    }
+}
+
+/**
+ * testBalance
+ * sorted inserts and removes keep the tree balanced, in order and
+ * with the same hashes as a tree built from the same data
+ */
+static void testBalance() {
+    vector<Num> nums;
+    for (int i = 0; i < 1000; i++) {
+        nums.push_back(Num(i));
+    }
+    SearchTree tree;
+    makeTree(tree, nums);
+    CHECK(tree.getHeight() <= maxHeight(1000));
+    CHECK(tree.getHeight() >= 10);
+
+    //remove every other one and the lowest hundred
+    bool removed = true;
+    for (int i = 0; i < 1000; i++) {
+        if (i % 2 == 1 || i < 100) {
+            removed = removed && tree.remove(Num(i));
+        }
+    }
+    CHECK(removed);
+    CHECK(!tree.remove(Num(1)));
+    CHECK(!tree.remove(Num(5000)));
+    CHECK(tree.getHeight() <= maxHeight(450));
+    vector<Comparable*> order = tree.traverseInOrder();
+    CHECK(order.size() == 450);
+    bool kept = order.size() == 450;
+    for (size_t i = 0; kept && i < order.size(); i++) {
+        kept = static_cast<Num*>(order[i])->value == 100 + 2 * static_cast<int>(i);
+    }
+    CHECK(kept);
+
+    //the hashes survive the rotations
+    vector<Num> rest;
+    for (int i = 100; i < 1000; i += 2) {
+        rest.push_back(Num(i));
+    }
+    vector<Comparable*> sorted;
+    for (size_t i = 0; i < rest.size(); i++) {
+        sorted.push_back(&rest[i]);
+    }
+    SearchTree built;
+    built.setOwnsData(false);
+    built.buildSorted(sorted);
+    CHECK(tree == built);
+    CHECK(tree.diff(built).empty());
+
+    //a second copy only raises the count and is removed first
+    tree.insert(&nums[200]);
+    CHECK(tree != built);
+    CHECK(tree.remove(Num(200)));
+    CHECK(tree == built);
+    CHECK(tree.retrieve(Num(200)) != nullptr);
+
+    //removing everything leaves an empty tree
+    for (size_t i = 0; i < rest.size(); i++) {
+        tree.remove(rest[i]);
+    }
+    CHECK(tree.getHeight() == 0);
+    CHECK(tree.traverseInOrder().empty());
+}
+
+int main() {
+    testShapes();
+    testCollision();
+    testDiff();
+    testRefresh();
+    testBuildSorted();
+    testBalance();
+    return TestCheck::report("SearchTreeTest");
+}
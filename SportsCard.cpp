@@ -33,42 +33,98 @@ SportsCard::SportsCard(const SportsCard& c) {
     manufacturer = c.manufacturer;
     count = c.count;
     year = c.year;
-    key = c.key;
+    packed = c.packed;
+    fingerprint = c.fingerprint;
+    row = c.row;
+    id = c.id;
     typeCol = c.typeCol;
     grade = c.grade;
 
 }
 
+/**
+* @brief Construct a new SportsCard object
+* this function takes over the data of an instance of SportsCard
+* so a SportsCard can be moved without copying its strings
+* @param c : instance of SportsCard that is moved from
+*/
+SportsCard::SportsCard(SportsCard&& c) noexcept {
+
+    player = c.player;
+    manufacturer = c.manufacturer;
+    count = c.count;
+    year = c.year;
+    packed = c.packed;
+    fingerprint = c.fingerprint;
+    row = c.row;
+    id = c.id;
+    typeCol = move(c.typeCol);
+    grade = c.grade;
+
+}
+
 /**
  * @brief Construct a new SportsCard object
  * this function takes in a string and sets the data members
  * of SportsCard based on the string
  * @param desc : whole description of the SportsCard
  */
-SportsCard::SportsCard(string desc) 
+SportsCard::SportsCard(string_view desc)
 {
-    //S, 1, 1952, Very Good, Mickey Mantle, Topps
-    vector<string> v;
-    stringstream ss(desc);
+    FieldTokenizer fields(desc);
+    parse(fields);
+}
 
-    while (ss.good()) {
-        string substr;
-        getline(ss, substr, ',');
-        v.push_back(substr);
-    }
-        typeCol = v[0];
-        count = stoi(v[1]);
-        year = stoi(v[2]);
-        grade = v[3];
-        player = v[4];
-        manufacturer = v[5];
-        grade.erase(grade.begin());
-        player.erase(player.begin());
-        manufacturer.erase(manufacturer.begin());
+/**
+ * @brief Construct a new SportsCard object
+ * this function sets the data members of SportsCard from the
+ * fields of a description that is already being split
+ * @param fields : tokenizer positioned at the first field
+ */
+SportsCard::SportsCard(FieldTokenizer& fields)
+{
+    parse(fields);
+}
 
-        key = typeCol + ", " + to_string(year) + 
-            ", " + grade + ", " + player + ", " + manufacturer;
+/**
+* parse
+* this function sets the data members of SportsCard from
+* the fields of its description and checks that every
+* field is there and every number is valid
+* @param fields : tokenizer positioned at the first field
+* @return ParseError::None if the record is valid
+*/
+ParseError SportsCard::parse(FieldTokenizer& fields)
+{
+    //S, 1, 1952, Very Good, Mickey Mantle, Topps
+    string_view typeField;
+    string_view gradeField;
+    string_view playerField;
+    string_view manufacturerField;
+    ParseError error = ParseError::None;
+    if ((error = fields.nextText(typeField)) != ParseError::None ||
+        (error = fields.nextInt(count)) != ParseError::None ||
+        (error = fields.nextInt(year)) != ParseError::None ||
+        (error = fields.nextText(gradeField)) != ParseError::None ||
+        (error = fields.nextText(playerField)) != ParseError::None ||
+        (error = fields.nextText(manufacturerField)) != ParseError::None) {
+        return error;
+    }
+    typeCol = typeField;
+    grade = SymbolTable::intern(gradeField);
+    player = SymbolTable::intern(playerField);
+    manufacturer = SymbolTable::intern(manufacturerField);
 
+    packed.tag = tag;
+    packed.prefix = PackedKey::makePrefix(playerField);
+    packed.high = PackedKey::pack(player, manufacturer);
+    packed.low = PackedKey::pack(PackedKey::bias(year), grade);
+    //the key is built in a reused buffer so nothing is allocated
+    static thread_local string keyBuffer;
+    keyBuffer.clear();
+    appendFields(keyBuffer, gradeField, playerField, manufacturerField);
+    fingerprint = Fingerprint::of(keyBuffer);
+    return ParseError::None;
 }
 
 /**
@@ -118,26 +174,22 @@ string SportsCard::getType() {
 bool SportsCard::operator<(const Comparable& colToCompare) const {
     const SportsCard& sc = static_cast<const SportsCard&>(colToCompare);
     //sorted by player, then by year, then by manufacturer, then by grade
-    if (this->player < sc.player) {
-        return true;
+    if (packed.prefix != sc.packed.prefix) {
+        return packed.prefix < sc.packed.prefix;
     }
-    else if (this->player == sc.player) {
-        if (this->year < sc.year) {
-            return true;
-        }
-        else if (this->year == sc.year) {
-            if (this->manufacturer < sc.manufacturer) {
-                return true;
-            }
-            else if (this->manufacturer == sc.manufacturer) {
-                if (this->grade < sc.grade) {
-                    return true;
-                }
-            }
-        }
+    //names that share the prefix are compared as strings, ids are
+    //in the order the names were read
+    if (this->player != sc.player) {
+        return SymbolTable::getName(this->player) < SymbolTable::getName(sc.player);
     }
-
-    return false;
+    if (this->year != sc.year) {
+        return this->year < sc.year;
+    }
+    if (this->manufacturer != sc.manufacturer) {
+        return SymbolTable::getName(this->manufacturer) <
+            SymbolTable::getName(sc.manufacturer);
+    }
+    return SymbolTable::getName(this->grade) < SymbolTable::getName(sc.grade);
 }
 
 /**
@@ -165,10 +217,7 @@ bool SportsCard::operator>(const Comparable& rhs) const {
 */
 bool SportsCard::operator==(const Comparable& colToCompare) const {
     const SportsCard& sc = static_cast<const SportsCard&>(colToCompare);
-    if (key == sc.key) {
-        return true;
-    }
-    return false;
+    return packed == sc.packed;
 }
 
 /**
@@ -192,13 +241,72 @@ Comparable* SportsCard::copy(const Comparable& c) {
     return new SportsCard(s);
 }
 
+/**
+* appendKey
+* this function appends the key of the Collectible to key
+* @param key : string the key is appended to
+*/
+void SportsCard::appendKey(string& key) const {
+    appendFields(key, SymbolTable::getName(grade), SymbolTable::getName(player),
+        SymbolTable::getName(manufacturer));
+}
+
+/**
+* appendFields
+* this function appends the key of the SportsCard to key with
+* the given names, parse passes the fields it read so it does
+* not look the names up in the SymbolTable
+* @param key : string the key is appended to
+* @param gradeName : name of the grade
+* @param playerName : name of the player
+* @param manufacturerName : name of the manufacturer
+*/
+void SportsCard::appendFields(string& key, string_view gradeName, string_view playerName,
+    string_view manufacturerName) const {
+    key.reserve(key.size() + typeCol.size() + gradeName.size() + playerName.size() +
+        manufacturerName.size() + 16);
+    key.append(typeCol).append(", ");
+    FieldTokenizer::appendInt(key, year);
+    key.append(", ").append(gradeName).append(", ").append(playerName);
+    key.append(", ").append(manufacturerName);
+}
+
 /**getKey
 * this function returns key for Collectible
 */
 string SportsCard::getKey() const {
+    string key;
+    appendKey(key);
     return key;
 }
 
+/**
+* hashCode
+* this function returns a hash of the fields and the count
+* of the SportsCard in inventory
+*/
+size_t SportsCard::hashCode() const {
+    size_t h = (static_cast<size_t>(player) << 40) ^
+        (static_cast<size_t>(manufacturer) << 16) ^ (static_cast<size_t>(grade) << 12) ^
+        static_cast<size_t>(year);
+    return hash<size_t>()(h) ^ (static_cast<size_t>(count) * 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+* getColumns
+* this function returns the fields of the SportsCard
+* as they are stored in a ColumnStore
+*/
+ColumnRow SportsCard::getColumns() const {
+    ColumnRow columns;
+    columns.count = count;
+    columns.year = year;
+    columns.grade = grade;
+    columns.first = player;
+    columns.second = manufacturer;
+    return columns;
+}
+
 /**
  * print
  * this function prints the description
@@ -207,5 +315,5 @@ string SportsCard::getKey() const {
 void SportsCard::print() const
 {
     cout << " Item: ";
-    cout << key << " (" << count << " left in store)" << endl;
+    cout << getKey() << " (" << count << " left in store)" << endl;
 }
@@ -22,6 +22,9 @@
  */
 #include "SportsCard.h"
 #include "Collectible.h"
+#include "FieldTokenizer.h"
+#include "ParseResult.h"
+#include "SymbolTable.h"
 
 class SportsCard : public Collectible
 {
@@ -29,15 +32,42 @@ private:
 
     string typeCol = "";
     int count = 0;
-    string player = "";
+    uint32_t player = 0; // interned player
     int year = 0;
-    string manufacturer = "";
-    string grade = ""; 
-    string key = "";
+    uint32_t manufacturer = 0; // interned manufacturer
+    uint32_t grade = 0; // interned grade
 
+    /**
+    * appendFields
+    * this function appends the key of the SportsCard to key with
+    * the given names, parse passes the fields it read so it does
+    * not look the names up in the SymbolTable
+    * @param key : string the key is appended to
+    * @param gradeName : name of the grade
+    * @param playerName : name of the player
+    * @param manufacturerName : name of the manufacturer
+    */
+    void appendFields(string& key, string_view gradeName, string_view playerName,
+        string_view manufacturerName) const;
 
 public:
 
+    //registry entry: first character of a sports card record and how
+    //a ColumnStore prints it
+    static constexpr char tag = 'S';
+    static constexpr bool namedGrades = true;
+    static constexpr bool hasSecond = true;
+
+    /**
+    * parse
+    * this function sets the data members of SportsCard from
+    * the fields of its description and checks that every
+    * field is there and every number is valid
+    * @param fields : tokenizer positioned at the first field
+    * @return ParseError::None if the record is valid
+    */
+    ParseError parse(FieldTokenizer& fields);
+
     /**
      * @brief Construct a new Sports Card object
      *
@@ -54,13 +84,39 @@ public:
      */
     SportsCard(const SportsCard& c);
 
+    /**
+     * @brief Construct a new SportsCard object
+     * this function takes over the data of an instance of SportsCard
+     * so a SportsCard can be moved without copying its strings
+     * @param c : instance of SportsCard that is moved from
+     */
+    SportsCard(SportsCard&& c) noexcept;
+
+    /**
+     * operator=
+     * this function copies or moves the data members of c
+     * into this SportsCard
+     * @param c : instance of SportsCard
+     * @return SportsCard& : this SportsCard
+     */
+    SportsCard& operator=(const SportsCard& c) = default;
+    SportsCard& operator=(SportsCard&& c) = default;
+
     /**
      * @brief Construct a new SportsCard object
      * this function takes in a string and sets the data members
      * of SportsCard based on the string
      * @param desc : whole description of the SportsCard
      */
-    SportsCard(string desc);
+    SportsCard(string_view desc);
+
+    /**
+     * @brief Construct a new SportsCard object
+     * this function sets the data members of SportsCard from the
+     * fields of a description that is already being split
+     * @param fields : tokenizer positioned at the first field
+     */
+    SportsCard(FieldTokenizer& fields);
 
     /**
      * @brief Destroy the Sports Card object
@@ -149,11 +205,32 @@ public:
     */
     Comparable* copy(const Comparable& c) override;
 
+    /**
+    * appendKey
+    * this function appends the key of the Collectible to key
+    * @param key : string the key is appended to
+    */
+    void appendKey(string& key) const override;
+
     /**getKey
     * this function returns key for Collectible
     */
     string getKey() const override;
 
+    /**
+    * hashCode
+    * this function returns a hash of the key and the count
+    * of the SportsCard in inventory
+    */
+    size_t hashCode() const override;
+
+    /**
+    * getColumns
+    * this function returns the fields of the SportsCard
+    * as they are stored in a ColumnStore
+    */
+    ColumnRow getColumns() const override;
+
     /**
      * printCollectible
      * this function prints the description
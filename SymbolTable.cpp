@@ -0,0 +1,211 @@
+#include "SymbolTable.h"
+#include <algorithm>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+/*
+ * @file SymbolTable.cpp
+ * @author Katarina McGaughy
+ * SymbolTable interns the strings that repeat across many collectibles
+ * (coin types, publishers, titles, players, manufacturers and grades).
+ * Every distinct string is stored once and items keep its 32 bit id, so
+ * two fields are equal when their ids are equal. Each id also has a rank
+ * that follows the alphabetical order of the strings so items can be
+ * ordered without comparing characters.
+ *
+ * Features:
+ * -intern a string and return its id
+ * -look up the string of an id
+ * -order ids alphabetically by rank
+ *
+ * Assumptions:
+ * -id 0 is the empty string
+ * -every function is safe to call from several threads at once
+ * -getName does not take the lock, the strings are kept in chunks
+ *  that never move and each chunk holds twice as many as the last
+ * -getRank of a ranked id does not take the lock, a rebuild publishes
+ *  a new rank vector and keeps the old ones for threads still reading
+ *  them, so the ranks are rebuilt once before a sort and not during it
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * @brief Construct a new SymbolTable object
+  * interns the empty string as id 0
+  */
+SymbolTable::SymbolTable() : ranks(nullptr) {
+    for (int c = 0; c < numChunks; c++) {
+        chunks[c].store(nullptr, memory_order_relaxed);
+    }
+    ids.emplace(string_view(add("")), 0);
+}
+
+/**
+ * @brief Destroy the SymbolTable object
+ * frees the chunks
+ */
+SymbolTable::~SymbolTable() {
+    for (int c = 0; c < numChunks; c++) {
+        delete[] chunks[c].load(memory_order_relaxed);
+    }
+}
+
+/**
+ * locate
+ * this function finds where the string of id is kept, chunk c
+ * holds the firstChunk << c ids after the ones of the chunks
+ * before it
+ * Preconditions: none
+ * Postconditions: returns the chunk of id and sets offset to the
+ * position of id in it
+ * @param id : id of the string
+ * @param offset : set to the position of id in its chunk
+ */
+uint32_t SymbolTable::locate(uint32_t id, uint32_t& offset) {
+    //chunk c starts at firstChunk * (2^c - 1), the highest bit of
+    //id / firstChunk + 1 is c
+    uint32_t slot = id / firstChunk + 1;
+#if defined(_MSC_VER)
+    unsigned long chunk;
+    _BitScanReverse(&chunk, slot);
+#else
+    uint32_t chunk = 31 - __builtin_clz(slot);
+#endif
+    offset = id - firstChunk * ((1u << chunk) - 1);
+    return static_cast<uint32_t>(chunk);
+}
+
+/**
+ * add
+ * this function stores name as the next id
+ * Preconditions: lock must be held, name must not be interned
+ * Postconditions: returns the stored string
+ * @param name : string to store
+ */
+const string& SymbolTable::add(string_view name) {
+    uint32_t offset = 0;
+    uint32_t chunk = locate(numNames, offset);
+    string* strings = chunks[chunk].load(memory_order_relaxed);
+    if (strings == nullptr) {
+        strings = new string[static_cast<size_t>(firstChunk) << chunk];
+        //getName reads the chunk pointer without the lock
+        chunks[chunk].store(strings, memory_order_release);
+    }
+    strings[offset].assign(name.data(), name.size());
+    numNames++;
+    return strings[offset];
+}
+
+/**
+ * table
+ * Preconditions: none
+ * Postconditions: returns the table shared by the whole program
+ */
+SymbolTable& SymbolTable::table() {
+    static SymbolTable symbols;
+    return symbols;
+}
+
+/**
+ * intern
+ * this function returns the id of name and adds name to the
+ * table if it is not in it yet, it is safe to call from
+ * several threads at once
+ * Preconditions: none
+ * Postconditions: returns the id of name
+ * @param name : string to intern
+ */
+uint32_t SymbolTable::intern(string_view name) {
+    SymbolTable& t = table();
+    lock_guard<mutex> guard(t.lock);
+    auto found = t.ids.find(name);
+    if (found != t.ids.end()) {
+        return found->second;
+    }
+    //the chunks never move their strings so the views stay valid
+    uint32_t id = t.numNames;
+    t.ids.emplace(string_view(t.add(name)), id);
+    return id;
+}
+
+/**
+ * getName
+ * this function looks up the string of id without the lock, the
+ * string never moves or changes once it is interned
+ * Preconditions: id must have been returned by intern
+ * Postconditions: returns the string of id
+ * @param id : id of the string
+ */
+const string& SymbolTable::getName(uint32_t id) {
+    uint32_t offset = 0;
+    uint32_t chunk = locate(id, offset);
+    return table().chunks[chunk].load(memory_order_acquire)[offset];
+}
+
+/**
+ * getRank
+ * this function returns the position of the string of id in
+ * alphabetical order, a ranked id is read without the lock and
+ * the ranks are rebuilt under it when id has none yet
+ * Preconditions: id must have been returned by intern, ranks are
+ * only comparable if none were rebuilt between reading them
+ * Postconditions: returns the rank of id
+ * @param id : id of the string
+ */
+uint32_t SymbolTable::getRank(uint32_t id) {
+    SymbolTable& t = table();
+    //a published vector never changes, only the pointer is replaced
+    const vector<uint32_t>* ranked = t.ranks.load(memory_order_acquire);
+    if (ranked != nullptr && id < ranked->size()) {
+        return (*ranked)[id];
+    }
+    lock_guard<mutex> guard(t.lock);
+    t.rankNames();
+    return (*t.ranks.load(memory_order_relaxed))[id];
+}
+
+/**
+ * rankAll
+ * this function gives every interned string its alphabetical rank,
+ * it is called before the ranks are read so getRank does not
+ * rebuild them in the middle of a sort
+ * Preconditions: none
+ * Postconditions: every id has a rank
+ */
+void SymbolTable::rankAll() {
+    SymbolTable& t = table();
+    lock_guard<mutex> guard(t.lock);
+    t.rankNames();
+}
+
+/**
+ * rankNames
+ * this function gives every interned string its alphabetical rank
+ * Preconditions: lock must be held
+ * Postconditions: every id has a rank
+ */
+void SymbolTable::rankNames() {
+    const vector<uint32_t>* ranked = ranks.load(memory_order_relaxed);
+    if (ranked != nullptr && ranked->size() == numNames) {
+        return;
+    }
+    vector<uint32_t> order(numNames);
+    for (uint32_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    sort(order.begin(), order.end(), [](uint32_t a, uint32_t b) {
+        return getName(a) < getName(b);
+    });
+    unique_ptr<vector<uint32_t>> rebuilt = make_unique<vector<uint32_t>>(order.size());
+    for (uint32_t r = 0; r < order.size(); r++) {
+        (*rebuilt)[order[r]] = r;
+    }
+    //threads may still read the old vector so it is kept
+    ranks.store(rebuilt.get(), memory_order_release);
+    rankVectors.push_back(move(rebuilt));
+}
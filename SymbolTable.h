@@ -0,0 +1,148 @@
+#pragma once
+/*
+ * @file SymbolTable.h
+ * @author Katarina McGaughy
+ * SymbolTable interns the strings that repeat across many collectibles
+ * (coin types, publishers, titles, players, manufacturers and grades).
+ * Every distinct string is stored once and items keep its 32 bit id, so
+ * two fields are equal when their ids are equal. Each id also has a rank
+ * that follows the alphabetical order of the strings so items can be
+ * ordered without comparing characters.
+ *
+ * Features:
+ * -intern a string and return its id
+ * -look up the string of an id
+ * -order ids alphabetically by rank
+ *
+ * Assumptions:
+ * -id 0 is the empty string
+ * -every function is safe to call from several threads at once
+ * -getName does not take the lock, the strings are kept in chunks
+ *  that never move and each chunk holds twice as many as the last
+ * -getRank of a ranked id does not take the lock, a rebuild publishes
+ *  a new rank vector and keeps the old ones for threads still reading
+ *  them, so the ranks are rebuilt once before a sort and not during it
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+using namespace std;
+
+class SymbolTable
+{
+private:
+    static constexpr uint32_t firstChunk = 1024;    // strings in the first chunk
+    static constexpr int numChunks = 23;            // chunks that hold every 32 bit id
+
+    atomic<string*> chunks[numChunks];          // strings of each chunk, nullptr until used
+    uint32_t numNames = 0;                      // strings interned so far
+    unordered_map<string_view, uint32_t> ids;   // id of every string
+    atomic<const vector<uint32_t>*> ranks;      // alphabetical rank of every id, nullptr if none
+    vector<unique_ptr<vector<uint32_t>>> rankVectors;  // every rank vector published
+    mutex lock;
+
+    /**
+     * @brief Construct a new SymbolTable object
+     * interns the empty string as id 0
+     */
+    SymbolTable();
+
+    /**
+     * @brief Destroy the SymbolTable object
+     * frees the chunks
+     */
+    ~SymbolTable();
+
+    /**
+     * locate
+     * this function finds where the string of id is kept, chunk c
+     * holds the firstChunk << c ids after the ones of the chunks
+     * before it
+     * Preconditions: none
+     * Postconditions: returns the chunk of id and sets offset to the
+     * position of id in it
+     * @param id : id of the string
+     * @param offset : set to the position of id in its chunk
+     */
+    static uint32_t locate(uint32_t id, uint32_t& offset);
+
+    /**
+     * add
+     * this function stores name as the next id
+     * Preconditions: lock must be held, name must not be interned
+     * Postconditions: returns the stored string
+     * @param name : string to store
+     */
+    const string& add(string_view name);
+
+    /**
+     * table
+     * Preconditions: none
+     * Postconditions: returns the table shared by the whole program
+     */
+    static SymbolTable& table();
+
+    /**
+     * rankNames
+     * this function gives every interned string its alphabetical rank
+     * Preconditions: lock must be held
+     * Postconditions: every id has a rank
+     */
+    void rankNames();
+
+public:
+
+    /**
+     * intern
+     * this function returns the id of name and adds name to the
+     * table if it is not in it yet, it is safe to call from
+     * several threads at once
+     * Preconditions: none
+     * Postconditions: returns the id of name
+     * @param name : string to intern
+     */
+    static uint32_t intern(string_view name);
+
+    /**
+     * getName
+     * this function looks up the string of id without the lock, the
+     * string never moves or changes once it is interned
+     * Preconditions: id must have been returned by intern
+     * Postconditions: returns the string of id
+     * @param id : id of the string
+     */
+    static const string& getName(uint32_t id);
+
+    /**
+     * getRank
+     * this function returns the position of the string of id in
+     * alphabetical order, a ranked id is read without the lock and
+     * the ranks are rebuilt under it when id has none yet
+     * Preconditions: id must have been returned by intern, ranks are
+     * only comparable if none were rebuilt between reading them
+     * Postconditions: returns the rank of id
+     * @param id : id of the string
+     */
+    static uint32_t getRank(uint32_t id);
+
+    /**
+     * rankAll
+     * this function gives every interned string its alphabetical rank,
+     * it is called before the ranks are read so getRank does not
+     * rebuild them in the middle of a sort
+     * Preconditions: none
+     * Postconditions: every id has a rank
+     */
+    static void rankAll();
+};
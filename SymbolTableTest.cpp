@@ -0,0 +1,140 @@
+#include "SymbolTable.h"
+#include "TestCheck.h"
+#include <thread>
+#include <algorithm>
+/*
+ * @file SymbolTableTest.cpp
+ * @author Katarina McGaughy
+ * SymbolTableTest checks that SymbolTable gives every string one id,
+ * ranks ids alphabetically and can be used from several threads.
+ *
+ * Build and run from the source directory, also with -fsanitize=thread:
+ * g++ -std=c++17 -pthread SymbolTableTest.cpp SymbolTable.cpp -o SymbolTableTest
+ * ./SymbolTableTest
+ *
+ * Features:
+ * -same string same id, id 0 is the empty string
+ * -ranks follow alphabetical order after new strings
+ * -intern, getName and getRank from several threads at once
+ * -sorts by rank on several threads while new strings are interned
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * testIntern
+  * a string keeps its id and the id gives back the string
+  */
+static void testIntern() {
+    CHECK(SymbolTable::intern("") == 0);
+    uint32_t dc = SymbolTable::intern("DC");
+    uint32_t marvel = SymbolTable::intern("Marvel");
+    string copy = "DC";
+    CHECK(dc != marvel);
+    CHECK(SymbolTable::intern(copy) == dc);
+    CHECK(SymbolTable::getName(dc) == "DC");
+    CHECK(SymbolTable::getName(marvel) == "Marvel");
+    CHECK(SymbolTable::getName(0).empty());
+}
+
+/**
+ * testRank
+ * ranks follow alphabetical order, also for strings interned after
+ * the ranks were built
+ */
+static void testRank() {
+    uint32_t topps = SymbolTable::intern("Topps");
+    uint32_t fleer = SymbolTable::intern("Fleer");
+    SymbolTable::rankAll();
+    CHECK(SymbolTable::getRank(fleer) < SymbolTable::getRank(topps));
+    uint32_t bowman = SymbolTable::intern("Bowman");
+    CHECK(SymbolTable::getRank(bowman) < SymbolTable::getRank(fleer));
+    CHECK(SymbolTable::getRank(0) < SymbolTable::getRank(bowman));
+}
+
+/**
+ * testThreads
+ * threads that intern new strings and threads that read names and
+ * ranks agree on every id
+ */
+static void testThreads() {
+    const int count = 2000;
+    vector<vector<uint32_t>> ids(4, vector<uint32_t>(count));
+    vector<thread> workers;
+    for (int w = 0; w < 4; w++) {
+        workers.emplace_back([w, count, &ids]() {
+            for (int i = 0; i < count; i++) {
+                uint32_t id = SymbolTable::intern("name " + to_string(i));
+                ids[w][i] = id;
+                //read back strings other threads may be adding
+                SymbolTable::getName(id);
+                SymbolTable::getRank(id);
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    bool same = true;
+    for (int i = 0; i < count; i++) {
+        for (int w = 1; w < 4; w++) {
+            same = same && ids[w][i] == ids[0][i];
+        }
+        same = same && SymbolTable::getName(ids[0][i]) == "name " + to_string(i);
+    }
+    CHECK(same);
+}
+
+/**
+ * testSortThreads
+ * after rankAll several threads sort the same ids by rank while
+ * another thread interns new strings, every sort comes out in
+ * alphabetical order
+ */
+static void testSortThreads() {
+    const int count = 5000;
+    vector<uint32_t> ids(count);
+    for (int i = 0; i < count; i++) {
+        ids[i] = SymbolTable::intern("sort " + to_string(count - i));
+    }
+    SymbolTable::rankAll();
+    vector<vector<uint32_t>> sorted(4, ids);
+    vector<thread> workers;
+    for (int w = 0; w < 4; w++) {
+        workers.emplace_back([w, &sorted]() {
+            stable_sort(sorted[w].begin(), sorted[w].end(), [](uint32_t a, uint32_t b) {
+                return SymbolTable::getRank(a) < SymbolTable::getRank(b);
+            });
+        });
+    }
+    //the ranked ids are read while the table grows
+    workers.emplace_back([count]() {
+        for (int i = 0; i < count; i++) {
+            SymbolTable::intern("new " + to_string(i));
+        }
+    });
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    vector<uint32_t> expected = ids;
+    sort(expected.begin(), expected.end(), [](uint32_t a, uint32_t b) {
+        return SymbolTable::getName(a) < SymbolTable::getName(b);
+    });
+    bool same = true;
+    for (int w = 0; w < 4; w++) {
+        same = same && sorted[w] == expected;
+    }
+    CHECK(same);
+}
+
+int main() {
+    testIntern();
+    testRank();
+    testThreads();
+    testSortThreads();
+    return TestCheck::report("SymbolTableTest");
+}
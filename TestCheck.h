@@ -0,0 +1,64 @@
+#pragma once
+/*
+ * @file TestCheck.h
+ * @author Katarina McGaughy
+ * TestCheck is the check the test drivers share. Each driver is a plain
+ * program next to the code it tests, every failed check is printed with
+ * its line and the driver returns the number of failures, so any exit
+ * code but 0 is a failed test.
+ *
+ * Features:
+ * -check a condition and count the failures
+ * -report the result of a driver
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <iostream>
+using namespace std;
+
+class TestCheck
+{
+private:
+    static inline int failures = 0;     // checks that failed so far
+    static inline int checks = 0;       // checks made so far
+
+public:
+
+    /**
+     * check
+     * this function counts a check and prints it if it failed
+     * Preconditions: none
+     * Postconditions: returns ok
+     * @param ok : result of the check
+     * @param what : text of the condition
+     * @param line : line of the check
+     */
+    static bool check(bool ok, const char* what, int line) {
+        checks++;
+        if (!ok) {
+            failures++;
+            cout << "FAILED line " << line << ": " << what << endl;
+        }
+        return ok;
+    }
+
+    /**
+     * report
+     * this function prints how many checks of the driver passed
+     * Preconditions: none
+     * Postconditions: returns the number of failed checks
+     * @param name : name of the driver
+     */
+    static int report(const char* name) {
+        cout << name << ": " << checks - failures << " of " << checks;
+        cout << " checks passed" << endl;
+        return failures;
+    }
+};
+
+//checks cond and prints its text and line if it is false
+#define CHECK(cond) TestCheck::check((cond), #cond, __LINE__)
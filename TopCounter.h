@@ -0,0 +1,115 @@
+#pragma once
+/*
+ * @file TopCounter.h
+ * @author Katarina McGaughy
+ * TopCounter counts how often each key is seen and keeps the keys
+ * sorted by count, highest first, as they are counted. A key that is
+ * counted again only swaps places with the first key of its old
+ * count, which is found by a binary search, so counting is
+ * O(log n) and the top K keys are simply the first K entries.
+ *
+ * Features:
+ * -count a key
+ * -get the count of a key
+ * -get the keys with the highest counts
+ *
+ * Assumptions:
+ * -keys can be hashed
+ * -keys with equal counts are in no particular order, the swap that
+ * keeps counting O(log n) can reorder them
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <utility>
+using namespace std;
+
+template <class Key>
+class TopCounter
+{
+public:
+    /**
+     * Entry struct holds a key and how often it was counted
+     */
+    struct Entry
+    {
+        Key key;
+        long count;
+    };
+
+private:
+    vector<Entry> entries;                  // sorted by count, highest first
+    unordered_map<Key, size_t> positions;   // index of each key in entries
+
+public:
+
+    /**
+     * add
+     * this function counts key once more and moves it ahead of
+     * the keys it now has a higher count than
+     * Preconditions: none
+     * Postconditions: the count of key is one higher
+     * @param key : key to count
+     */
+    void add(const Key& key) {
+        auto found = positions.find(key);
+        if (found == positions.end()) {
+            positions.emplace(key, entries.size());
+            //every other key was counted at least once so the
+            //end is already its place
+            entries.push_back({ key, 1 });
+            return;
+        }
+        size_t index = found->second;
+        long oldCount = entries[index].count;
+        //first entry with the old count, entries are sorted descending
+        size_t first = lower_bound(entries.begin(), entries.begin() + index, oldCount,
+            [](const Entry& entry, long count) { return entry.count > count; }) -
+            entries.begin();
+        if (first != index) {
+            swap(entries[first], entries[index]);
+            positions[entries[index].key] = index;
+            found->second = first;
+        }
+        entries[first].count++;
+    }
+
+    /**
+     * getCount
+     * Preconditions: none
+     * Postconditions: returns how often key was counted, 0 if never
+     * @param key : key to look up
+     */
+    long getCount(const Key& key) const {
+        auto found = positions.find(key);
+        return found == positions.end() ? 0 : entries[found->second].count;
+    }
+
+    /**
+     * top
+     * Preconditions: none
+     * Postconditions: returns the at most k keys with the highest
+     * counts, highest first
+     * @param k : number of keys wanted
+     */
+    vector<Entry> top(size_t k) const {
+        k = min(k, entries.size());
+        return vector<Entry>(entries.begin(), entries.begin() + k);
+    }
+
+    /**
+     * clear
+     * Preconditions: none
+     * Postconditions: no key has been counted
+     */
+    void clear() {
+        entries.clear();
+        positions.clear();
+    }
+};
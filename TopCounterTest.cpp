@@ -0,0 +1,106 @@
+#include "TopCounter.h"
+#include "TestCheck.h"
+#include <random>
+#include <map>
+#include <string>
+/*
+ * @file TopCounterTest.cpp
+ * @author Katarina McGaughy
+ * TopCounterTest checks that TopCounter keeps its keys sorted by count
+ * as they are counted and gives the same counts as a plain map.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 TopCounterTest.cpp -o TopCounterTest
+ * ./TopCounterTest
+ *
+ * Features:
+ * -counts and order of a few keys
+ * -ties do not lose or repeat keys
+ * -many random counts against a map
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * sortedByCount
+  * Preconditions: none
+  * Postconditions: returns true if entries are sorted by count,
+  * highest first
+  * @param entries : entries to check
+  */
+template <class Key>
+static bool sortedByCount(const vector<typename TopCounter<Key>::Entry>& entries) {
+    for (size_t i = 1; i < entries.size(); i++) {
+        if (entries[i - 1].count < entries[i].count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * testOrder
+ * a key counted more often moves ahead of the others
+ */
+static void testOrder() {
+    TopCounter<string> counter;
+    CHECK(counter.top(3).empty());
+    counter.add("A");
+    counter.add("B");
+    counter.add("C");
+    counter.add("A");
+    counter.add("B");
+    counter.add("C");
+    counter.add("C");
+    vector<TopCounter<string>::Entry> top = counter.top(3);
+    CHECK(top.size() == 3);
+    CHECK(top[0].key == "C" && top[0].count == 3);
+    CHECK(top[1].count == 2 && top[2].count == 2);
+    CHECK(top[1].key != top[2].key && top[1].key != "C" && top[2].key != "C");
+    CHECK(counter.getCount("A") == 2);
+    CHECK(counter.getCount("D") == 0);
+    CHECK(counter.top(1).size() == 1);
+    CHECK(counter.top(10).size() == 3);
+    counter.clear();
+    CHECK(counter.top(3).empty());
+    CHECK(counter.getCount("C") == 0);
+}
+
+/**
+ * testRandom
+ * many random counts give the same counts as a map and stay sorted
+ */
+static void testRandom() {
+    TopCounter<int> counter;
+    map<int, long> expected;
+    mt19937 random(2022);
+    bool sorted = true;
+    for (int i = 0; i < 20000; i++) {
+        //a few keys are counted much more often than the rest
+        int key = static_cast<int>(random() % 8 == 0 ? random() % 5 : random() % 500);
+        counter.add(key);
+        expected[key]++;
+        if (i % 1000 == 0) {
+            sorted = sorted && sortedByCount<int>(counter.top(1000));
+        }
+    }
+    vector<TopCounter<int>::Entry> all = counter.top(1000);
+    CHECK(sorted);
+    CHECK(sortedByCount<int>(all));
+    CHECK(all.size() == expected.size());
+    bool same = true;
+    for (size_t i = 0; i < all.size(); i++) {
+        same = same && expected[all[i].key] == all[i].count;
+    }
+    CHECK(same);
+}
+
+int main() {
+    testOrder();
+    testRandom();
+    return TestCheck::report("TopCounterTest");
+}
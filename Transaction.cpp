@@ -27,15 +27,6 @@
 Transaction::Transaction(Collectible* it, char transactionType) :
     item(it), transType(transactionType) {}
 
-/**
- * @brief Destroy the Transaction object
- *
- */
-Transaction::~Transaction()
-{
-    item = nullptr;
-}
-
 /**
 * getItem
 * Preconditions: none
@@ -46,22 +37,44 @@ Collectible* Transaction::getItem() const {
     return item;
 }
 
+/**
+* getType
+* Preconditions: none
+* Postconditions: returns B if the item was bought from the
+* store, S if it was sold to it and F if the sale failed
+*/
+char Transaction::getType() const {
+    return transType;
+}
+
 /**
 * printTransaction
 * Preconditions: none
 * Postconditions: prints the transaction
 */
 void Transaction::printTransaction() const {
+    string line;
+    appendTransaction(line);
+    cout << line;
+}
+
+/**
+* appendTransaction
+* Preconditions: none
+* Postconditions: the line printTransaction displays is
+* appended to out
+* @param out : string the line is appended to
+*/
+void Transaction::appendTransaction(string& out) const {
     if (transType == 'S') {
-        cout << "Sold to store: ";
+        out.append("Sold to store: ");
     }
     else if (transType == 'F') {
-        cout << "Transaction failed for: ";
+        out.append("Transaction failed for: ");
     }
     else {
-        cout << "Bought from store: ";
+        out.append("Bought from store: ");
     }
-    item->print();
-
-} 
+    item->appendPrint(out);
+}
 
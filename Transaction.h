@@ -4,9 +4,13 @@
  * @author Katarina McGaughy
  * Transactions class stores a pointer to a Collectible item
  * and flags is the item is sold or bought in the transaction
+ * The journal stores the ID of the item and hands out a Transaction
+ * for a row with the item found, it owns nothing so it is copied
+ * as plain data
  *
  * Features:
  * -store transaction
+ * -keep running totals of transactions
  *
  * @version 0.1
  * @date 2022-2-21
@@ -17,6 +21,56 @@
 
 #include "Collectible.h"
 
+/**
+ * TransactionTotals struct holds running counts of transactions,
+ * it is updated as each transaction is made so reports never read
+ * the history
+ */
+struct TransactionTotals
+{
+    long bought = 0;    // items bought from the store
+    long sold = 0;      // items sold to the store
+    long failed = 0;    // sales to the store that failed
+
+    /**
+     * add
+     * this function counts one transaction of type
+     * Preconditions: none
+     * Postconditions: the count of type is one higher
+     * @param type : B, S or F
+     */
+    void add(char type) {
+        if (type == 'S') {
+            sold++;
+        }
+        else if (type == 'F') {
+            failed++;
+        }
+        else {
+            bought++;
+        }
+    }
+
+    /**
+     * held
+     * Preconditions: none
+     * Postconditions: returns the items bought from the store that
+     * have not been sold back
+     */
+    long held() const {
+        return bought - sold;
+    }
+
+    /**
+     * total
+     * Preconditions: none
+     * Postconditions: returns the number of transactions
+     */
+    long total() const {
+        return bought + sold + failed;
+    }
+};
+
 class Transaction
 {
 private:
@@ -35,12 +89,6 @@ public:
      */
     Transaction(Collectible* it, char transactionType);
 
-    /**
-     * @brief Destroy the Transaction object
-     *
-     */
-    ~Transaction();
-
     /**
     * printTransaction
     * Preconditions: none 
@@ -48,6 +96,15 @@ public:
     */
     void printTransaction() const; 
 
+    /**
+    * appendTransaction
+    * Preconditions: none
+    * Postconditions: the line printTransaction displays is
+    * appended to out
+    * @param out : string the line is appended to
+    */
+    void appendTransaction(string& out) const;
+
     /**
    * getItem
    * Preconditions: none
@@ -56,6 +113,14 @@ public:
    */
     Collectible* getItem() const;
 
+    /**
+    * getType
+    * Preconditions: none
+    * Postconditions: returns B if the item was bought from the
+    * store, S if it was sold to it and F if the sale failed
+    */
+    char getType() const;
+
 
 };
 
@@ -0,0 +1,426 @@
+#include "TransactionJournal.h"
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include "Customer.h"
+#include "FieldTokenizer.h"
+/*
+ * @file TransactionJournal.cpp
+ * @author Katarina McGaughy
+ * TransactionJournal is the one append only log of every transaction
+ * made in the store. Each field is kept in its own column along with
+ * the sequence number of the transaction, customers and items are
+ * kept as their dense IDs and found through the IdTables of the store
+ * so a row never points into memory. Customers keep the rows of
+ * their own transactions and the journal keeps the rows of every item
+ * by its ID, so the history of a customer or of an item is
+ * found without looking at any other transaction. Times never go
+ * down from one row to the next, so the rows of a customer can be
+ * binary searched by time. When the journal is compacted the rows
+ * spilled to the HistorySegment are dropped and the rest move down.
+ *
+ * Features:
+ * -append a transaction
+ * -get the fields of a row
+ * -find the rows of an item
+ * -display the transactions of an item
+ * -read dates and find the rows in a range of time
+ * -keep store wide totals
+ * -rank the best selling items and most active customers
+ * -drop the rows that were spilled to a HistorySegment
+ *
+ * Assumptions:
+ * -the IdTables outlive the journal and an ID always names the
+ * same Customer or Collectible
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * append
+  * this function adds a transaction to the end of the journal
+  * stamped with the current time, or the time of the last row if
+  * the clock went back
+  * Preconditions: customerId and itemId must be in the IdTables
+  * Postconditions: the journal is one row longer
+  * @param customerId : ID of the customer that made the transaction
+  * @param itemId : ID of the item bought or sold
+  * @param type : B, S or F
+  * @return uint32_t : row of the transaction
+  */
+uint32_t TransactionJournal::append(uint32_t customerId, uint32_t itemId, char type) {
+    uint32_t row = static_cast<uint32_t>(types.size());
+    int64_t now = chrono::duration_cast<chrono::seconds>(
+        chrono::system_clock::now().time_since_epoch()).count();
+    //the wall clock can be set back, the journal stays in order
+    lastTime = max(now, lastTime);
+    times.push_back(lastTime);
+    customers.push_back(customerId);
+    items.push_back(itemId);
+    types.push_back(type);
+    sequences.push_back(nextSequence++);
+    if (itemId >= itemRows.size()) {
+        itemRows.resize(itemId + 1);
+    }
+    itemRows[itemId].push_back(row);
+    totals.add(type);
+    if (type == 'B') {
+        itemsSold.add(itemId);
+    }
+    activeCustomers.add(customerId);
+    return row;
+}
+
+/**
+ * setIdTables
+ * this function sets the tables the IDs of the rows are found in
+ * Preconditions: none
+ * Postconditions: IDs are resolved with customerTable and itemTable
+ * @param customerTable : customer of each ID
+ * @param itemTable : item of each ID
+ */
+void TransactionJournal::setIdTables(const IdTable<Customer>* customerTable,
+    const IdTable<Collectible>* itemTable) {
+    customerIds = customerTable;
+    itemIds = itemTable;
+}
+
+/**
+ * size
+ * Preconditions: none
+ * Postconditions: returns the number of transactions
+ */
+size_t TransactionJournal::size() const {
+    return types.size();
+}
+
+/**
+ * getTransaction
+ * Preconditions: row must be less than size
+ * Postconditions: returns the item and type of the row
+ * @param row : sequence number of the transaction
+ */
+Transaction TransactionJournal::getTransaction(uint32_t row) const {
+    return Transaction(getItemById(items[row]), types[row]);
+}
+
+/**
+ * getCustomer
+ * Preconditions: row must be less than size
+ * Postconditions: returns the customer of the row
+ * @param row : sequence number of the transaction
+ */
+Customer* TransactionJournal::getCustomer(uint32_t row) const {
+    return getCustomerById(customers[row]);
+}
+
+/**
+ * getItemId
+ * Preconditions: row must be less than size
+ * Postconditions: returns the ID of the item of the row
+ * @param row : row of the transaction
+ */
+uint32_t TransactionJournal::getItemId(uint32_t row) const {
+    return items[row];
+}
+
+/**
+ * getCustomerById
+ * Preconditions: none
+ * Postconditions: returns the customer of id, nullptr if none
+ * @param id : ID of the customer
+ */
+Customer* TransactionJournal::getCustomerById(uint32_t id) const {
+    return customerIds == nullptr ? nullptr : customerIds->get(id);
+}
+
+/**
+ * getItemById
+ * Preconditions: none
+ * Postconditions: returns the item of id, nullptr if none
+ * @param id : ID of the item
+ */
+Collectible* TransactionJournal::getItemById(uint32_t id) const {
+    return itemIds == nullptr ? nullptr : itemIds->get(id);
+}
+
+/**
+ * getTime
+ * Preconditions: row must be less than size
+ * Postconditions: returns when the row was added in seconds
+ * since the epoch
+ * @param row : sequence number of the transaction
+ */
+int64_t TransactionJournal::getTime(uint32_t row) const {
+    return times[row];
+}
+
+/**
+ * getSequence
+ * Preconditions: row must be less than size
+ * Postconditions: returns the sequence number of the row, it
+ * does not change when the journal is compacted
+ * @param row : row of the transaction
+ */
+uint32_t TransactionJournal::getSequence(uint32_t row) const {
+    return sequences[row];
+}
+
+/**
+ * getLastTime
+ * Preconditions: none
+ * Postconditions: returns the time of the newest row
+ */
+int64_t TransactionJournal::getLastTime() const {
+    return lastTime;
+}
+
+/**
+ * findTimeRange
+ * this function binary searches rows for the transactions made
+ * from from to to
+ * Preconditions: rows must be in journal order
+ * Postconditions: returns the first and one past the last
+ * position in rows that is in the range
+ * @param rows : rows of the journal
+ * @param from : first second of the range
+ * @param to : last second of the range
+ */
+pair<size_t, size_t> TransactionJournal::findTimeRange(const vector<uint32_t>& rows,
+    int64_t from, int64_t to) const {
+    auto first = lower_bound(rows.begin(), rows.end(), from,
+        [this](uint32_t row, int64_t time) { return times[row] < time; });
+    auto last = upper_bound(first, rows.end(), to,
+        [this](int64_t time, uint32_t row) { return time < times[row]; });
+    return { static_cast<size_t>(first - rows.begin()),
+        static_cast<size_t>(last - rows.begin()) };
+}
+
+/**
+ * parseDate
+ * this function reads a date written YYYY-MM-DD
+ * Preconditions: none
+ * Postconditions: returns false if text is not a date or the
+ * day is not in the month
+ * @param text : date to read
+ * @param seconds : set to the first second of the day in UTC
+ * @return true : if text is a date
+ */
+bool TransactionJournal::parseDate(string_view text, int64_t& seconds) {
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\r')) {
+        text.remove_suffix(1);
+    }
+    if (text.size() != 10 || text[4] != '-' || text[7] != '-') {
+        return false;
+    }
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    if (!FieldTokenizer::toInt(text.substr(0, 4), year) ||
+        !FieldTokenizer::toInt(text.substr(5, 2), month) ||
+        !FieldTokenizer::toInt(text.substr(8, 2), day) ||
+        month < 1 || month > 12 || day < 1) {
+        return false;
+    }
+    //the day must be in the month, February has 29 days in leap years
+    static const int daysInMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    if (day > daysInMonth[month - 1] + (month == 2 && leap ? 1 : 0)) {
+        return false;
+    }
+    //days since 1970-01-01 of a date in the proleptic Gregorian calendar
+    int64_t y = month <= 2 ? year - 1 : year;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    int64_t yearOfEra = y - era * 400;
+    int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    seconds = (era * 146097 + dayOfEra - 719468) * 86400;
+    return true;
+}
+
+/**
+ * getItemRows
+ * Preconditions: none
+ * Postconditions: returns the rows of every transaction of item
+ * in order, empty if it has none
+ * @param item : Collectible to look up
+ */
+const vector<uint32_t>& TransactionJournal::getItemRows(const Collectible* item) const {
+    static const vector<uint32_t> none;
+    uint32_t id = item->getId();
+    return id < itemRows.size() ? itemRows[id] : none;
+}
+
+/**
+ * displayItem
+ * this function prints every transaction of item in order with
+ * its sequence number and customer, the spilled ones are read
+ * back from the segment
+ * Preconditions: none
+ * Postconditions: the transactions are printed
+ * @param item : Collectible to look up
+ */
+void TransactionJournal::displayItem(const Collectible* item) const {
+    const vector<uint32_t>& rows = getItemRows(item);
+    vector<HistorySegment::ItemRow> spilled;
+    if (segment != nullptr && segment->getItemCount(item->getId()) > 0) {
+        spilled = segment->readItem(item->getId());
+    }
+    if (rows.empty() && spilled.empty()) {
+        cout << " none " << endl;
+        return;
+    }
+    //a customer keeps its newest rows, so the spilled rows of one
+    //customer can be newer than the rows another one kept
+    string out;
+    size_t cold = 0;
+    size_t hot = 0;
+    while (cold < spilled.size() || hot < rows.size()) {
+        uint32_t customerId;
+        uint32_t sequence;
+        char type;
+        if (hot == rows.size() ||
+            (cold < spilled.size() && spilled[cold].sequence < sequences[rows[hot]])) {
+            customerId = spilled[cold].customerId;
+            sequence = spilled[cold].sequence;
+            type = spilled[cold].type;
+            cold++;
+        }
+        else {
+            customerId = customers[rows[hot]];
+            sequence = sequences[rows[hot]];
+            type = types[rows[hot]];
+            hot++;
+        }
+        const Customer* customer = getCustomerById(customerId);
+        out.append("#").append(to_string(sequence)).append(" ");
+        out.append(customer->getCustomerID()).append(" ");
+        out.append(customer->getName()).append(": ");
+        Transaction(getItemById(item->getId()), type).appendTransaction(out);
+    }
+    cout << out;
+}
+
+/**
+ * getTotals
+ * Preconditions: none
+ * Postconditions: returns the counts of every transaction
+ * in the journal by type
+ */
+const TransactionTotals& TransactionJournal::getTotals() const {
+    return totals;
+}
+
+/**
+ * getTopItems
+ * Preconditions: none
+ * Postconditions: returns the IDs of the at most k items with
+ * the most units bought from the store, most first
+ * @param k : number of items wanted
+ */
+vector<TopCounter<uint32_t>::Entry> TransactionJournal::getTopItems(size_t k) const {
+    return itemsSold.top(k);
+}
+
+/**
+ * getTopCustomers
+ * Preconditions: none
+ * Postconditions: returns the IDs of the at most k customers with
+ * the most transactions, most first
+ * @param k : number of customers wanted
+ */
+vector<TopCounter<uint32_t>::Entry> TransactionJournal::getTopCustomers(size_t k) const {
+    return activeCustomers.top(k);
+}
+
+/**
+ * setSegment
+ * Preconditions: none
+ * Postconditions: rows are spilled to s
+ * @param s : cold tier of the history, nullptr for none
+ */
+void TransactionJournal::setSegment(HistorySegment* s) {
+    segment = s;
+}
+
+/**
+ * getSegment
+ * Preconditions: none
+ * Postconditions: returns the cold tier of the history, nullptr
+ * if there is none
+ */
+HistorySegment* TransactionJournal::getSegment() const {
+    return segment;
+}
+
+/**
+ * removeRows
+ * this function drops every row marked in spilled and moves the
+ * rest down in order, the rows of every item move with them
+ * Preconditions: spilled must have one entry per row
+ * Postconditions: returns the new row of every old row, UINT32_MAX
+ * for the rows that were dropped
+ * @param spilled : true for each row to drop
+ */
+vector<uint32_t> TransactionJournal::removeRows(const vector<bool>& spilled) {
+    vector<uint32_t> moved(types.size(), UINT32_MAX);
+    uint32_t kept = 0;
+    for (uint32_t row = 0; row < types.size(); row++) {
+        if (spilled[row]) {
+            continue;
+        }
+        moved[row] = kept;
+        times[kept] = times[row];
+        customers[kept] = customers[row];
+        items[kept] = items[row];
+        types[kept] = types[row];
+        sequences[kept] = sequences[row];
+        kept++;
+    }
+    //give the memory of the dropped rows back
+    times.resize(kept);
+    times.shrink_to_fit();
+    customers.resize(kept);
+    customers.shrink_to_fit();
+    items.resize(kept);
+    items.shrink_to_fit();
+    types.resize(kept);
+    types.shrink_to_fit();
+    sequences.resize(kept);
+    sequences.shrink_to_fit();
+    for (size_t id = 0; id < itemRows.size(); id++) {
+        vector<uint32_t>& rows = itemRows[id];
+        size_t count = 0;
+        for (size_t i = 0; i < rows.size(); i++) {
+            if (moved[rows[i]] != UINT32_MAX) {
+                rows[count++] = moved[rows[i]];
+            }
+        }
+        rows.resize(count);
+        rows.shrink_to_fit();
+    }
+    return moved;
+}
+
+/**
+ * clear
+ * Preconditions: none
+ * Postconditions: the journal has no rows
+ */
+void TransactionJournal::clear() {
+    times.clear();
+    customers.clear();
+    items.clear();
+    types.clear();
+    sequences.clear();
+    nextSequence = 1;
+    itemRows.clear();
+    lastTime = 0;
+    totals = TransactionTotals();
+    itemsSold.clear();
+    activeCustomers.clear();
+}
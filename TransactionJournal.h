@@ -0,0 +1,271 @@
+#pragma once
+/*
+ * @file TransactionJournal.h
+ * @author Katarina McGaughy
+ * TransactionJournal is the one append only log of every transaction
+ * made in the store. Each field is kept in its own column along with
+ * the sequence number of the transaction, customers and items are
+ * kept as their dense IDs and found through the IdTables of the store
+ * so a row never points into memory. Customers keep the rows of
+ * their own transactions and the journal keeps the rows of every item
+ * by its ID, so the history of a customer or of an item is
+ * found without looking at any other transaction. Times never go
+ * down from one row to the next, so the rows of a customer can be
+ * binary searched by time. When the journal is compacted the rows
+ * spilled to the HistorySegment are dropped and the rest move down.
+ *
+ * Features:
+ * -append a transaction
+ * -get the fields of a row
+ * -find the rows of an item
+ * -display the transactions of an item
+ * -read dates and find the rows in a range of time
+ * -keep store wide totals
+ * -rank the best selling items and most active customers
+ * -drop the rows that were spilled to a HistorySegment
+ *
+ * Assumptions:
+ * -the IdTables outlive the journal and an ID always names the
+ * same Customer or Collectible
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <string_view>
+#include "Transaction.h"
+#include "TopCounter.h"
+#include "HistorySegment.h"
+#include "IdTable.h"
+using namespace std;
+
+class Customer;
+
+class TransactionJournal
+{
+private:
+    vector<int64_t> times;              // seconds since the epoch of each row
+    vector<uint32_t> customers;         // ID of the customer of each row
+    vector<uint32_t> items;             // ID of the item of each row
+    vector<char> types;                 // B, S or F of each row
+    vector<uint32_t> sequences;         // sequence number of each row, from 1
+    vector<vector<uint32_t>> itemRows;  // rows of each item by ID
+    int64_t lastTime = 0;               // time of the last row
+    uint32_t nextSequence = 1;          // sequence number of the next row
+    HistorySegment* segment = nullptr;  // where spilled rows are, nullptr if none
+    const IdTable<Customer>* customerIds = nullptr;     // customer of each ID
+    const IdTable<Collectible>* itemIds = nullptr;      // item of each ID
+    TransactionTotals totals;           // counts of every row by type
+    TopCounter<uint32_t> itemsSold;     // units of each item ID bought from the store
+    TopCounter<uint32_t> activeCustomers; // transactions of each customer ID
+
+public:
+
+    /**
+     * append
+     * this function adds a transaction to the end of the journal
+     * stamped with the current time, or the time of the last row if
+     * the clock went back
+     * Preconditions: customerId and itemId must be in the IdTables
+     * Postconditions: the journal is one row longer
+     * @param customerId : ID of the customer that made the transaction
+     * @param itemId : ID of the item bought or sold
+     * @param type : B, S or F
+     * @return uint32_t : row of the transaction
+     */
+    uint32_t append(uint32_t customerId, uint32_t itemId, char type);
+
+    /**
+     * setIdTables
+     * this function sets the tables the IDs of the rows are found in
+     * Preconditions: none
+     * Postconditions: IDs are resolved with customerTable and itemTable
+     * @param customerTable : customer of each ID
+     * @param itemTable : item of each ID
+     */
+    void setIdTables(const IdTable<Customer>* customerTable,
+        const IdTable<Collectible>* itemTable);
+
+    /**
+     * size
+     * Preconditions: none
+     * Postconditions: returns the number of transactions
+     */
+    size_t size() const;
+
+    /**
+     * getTransaction
+     * Preconditions: row must be less than size
+     * Postconditions: returns the item and type of the row
+     * @param row : sequence number of the transaction
+     */
+    Transaction getTransaction(uint32_t row) const;
+
+    /**
+     * getCustomer
+     * Preconditions: row must be less than size
+     * Postconditions: returns the customer of the row
+     * @param row : sequence number of the transaction
+     */
+    Customer* getCustomer(uint32_t row) const;
+
+    /**
+     * getItemId
+     * Preconditions: row must be less than size
+     * Postconditions: returns the ID of the item of the row
+     * @param row : row of the transaction
+     */
+    uint32_t getItemId(uint32_t row) const;
+
+    /**
+     * getCustomerById
+     * Preconditions: none
+     * Postconditions: returns the customer of id, nullptr if none
+     * @param id : ID of the customer
+     */
+    Customer* getCustomerById(uint32_t id) const;
+
+    /**
+     * getItemById
+     * Preconditions: none
+     * Postconditions: returns the item of id, nullptr if none
+     * @param id : ID of the item
+     */
+    Collectible* getItemById(uint32_t id) const;
+
+    /**
+     * getTime
+     * Preconditions: row must be less than size
+     * Postconditions: returns when the row was added in seconds
+     * since the epoch
+     * @param row : sequence number of the transaction
+     */
+    int64_t getTime(uint32_t row) const;
+
+    /**
+     * getSequence
+     * Preconditions: row must be less than size
+     * Postconditions: returns the sequence number of the row, it
+     * does not change when the journal is compacted
+     * @param row : row of the transaction
+     */
+    uint32_t getSequence(uint32_t row) const;
+
+    /**
+     * getLastTime
+     * Preconditions: none
+     * Postconditions: returns the time of the newest row
+     */
+    int64_t getLastTime() const;
+
+    /**
+     * findTimeRange
+     * this function binary searches rows for the transactions made
+     * from from to to
+     * Preconditions: rows must be in journal order
+     * Postconditions: returns the first and one past the last
+     * position in rows that is in the range
+     * @param rows : rows of the journal
+     * @param from : first second of the range
+     * @param to : last second of the range
+     */
+    pair<size_t, size_t> findTimeRange(const vector<uint32_t>& rows,
+        int64_t from, int64_t to) const;
+
+    /**
+     * parseDate
+     * this function reads a date written YYYY-MM-DD
+     * Preconditions: none
+     * Postconditions: returns false if text is not a date or the
+     * day is not in the month
+     * @param text : date to read
+     * @param seconds : set to the first second of the day in UTC
+     * @return true : if text is a date
+     */
+    static bool parseDate(string_view text, int64_t& seconds);
+
+    /**
+     * getItemRows
+     * Preconditions: none
+     * Postconditions: returns the rows of every transaction of item
+     * in order, empty if it has none
+     * @param item : Collectible to look up
+     */
+    const vector<uint32_t>& getItemRows(const Collectible* item) const;
+
+    /**
+     * displayItem
+     * this function prints every transaction of item in order with
+     * its sequence number and customer, the spilled ones are read
+     * back from the segment
+     * Preconditions: none
+     * Postconditions: the transactions are printed
+     * @param item : Collectible to look up
+     */
+    void displayItem(const Collectible* item) const;
+
+    /**
+     * getTotals
+     * Preconditions: none
+     * Postconditions: returns the counts of every transaction
+     * in the journal by type
+     */
+    const TransactionTotals& getTotals() const;
+
+    /**
+     * getTopItems
+     * Preconditions: none
+     * Postconditions: returns the IDs of the at most k items with
+     * the most units bought from the store, most first
+     * @param k : number of items wanted
+     */
+    vector<TopCounter<uint32_t>::Entry> getTopItems(size_t k) const;
+
+    /**
+     * getTopCustomers
+     * Preconditions: none
+     * Postconditions: returns the IDs of the at most k customers with
+     * the most transactions, most first
+     * @param k : number of customers wanted
+     */
+    vector<TopCounter<uint32_t>::Entry> getTopCustomers(size_t k) const;
+
+    /**
+     * setSegment
+     * Preconditions: none
+     * Postconditions: rows are spilled to s
+     * @param s : cold tier of the history, nullptr for none
+     */
+    void setSegment(HistorySegment* s);
+
+    /**
+     * getSegment
+     * Preconditions: none
+     * Postconditions: returns the cold tier of the history, nullptr
+     * if there is none
+     */
+    HistorySegment* getSegment() const;
+
+    /**
+     * removeRows
+     * this function drops every row marked in spilled and moves the
+     * rest down in order, the rows of every item move with them
+     * Preconditions: spilled must have one entry per row
+     * Postconditions: returns the new row of every old row, UINT32_MAX
+     * for the rows that were dropped
+     * @param spilled : true for each row to drop
+     */
+    vector<uint32_t> removeRows(const vector<bool>& spilled);
+
+    /**
+     * clear
+     * Preconditions: none
+     * Postconditions: the journal has no rows
+     */
+    void clear();
+};
@@ -0,0 +1,57 @@
+#include "TransactionJournal.h"
+#include "TestCheck.h"
+/*
+ * @file TransactionJournalTest.cpp
+ * @author Katarina McGaughy
+ * TransactionJournalTest checks how TransactionJournal reads the dates
+ * of a history range.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -pthread TransactionJournalTest.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o TransactionJournalTest
+ * ./TransactionJournalTest
+ *
+ * Features:
+ * -dates read as the first second of the day
+ * -days that are not in their month are rejected
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+ /**
+  * testParseDate
+  * dates are read as UTC days and impossible dates are rejected
+  */
+static void testParseDate() {
+    int64_t seconds = -1;
+    CHECK(TransactionJournal::parseDate("1970-01-01", seconds) && seconds == 0);
+    CHECK(TransactionJournal::parseDate("1970-01-02 \r", seconds) && seconds == 86400);
+    CHECK(TransactionJournal::parseDate("2022-02-21", seconds) && seconds == 1645401600);
+    CHECK(TransactionJournal::parseDate("1969-12-31", seconds) && seconds == -86400);
+
+    //month lengths and leap years
+    CHECK(TransactionJournal::parseDate("2022-01-31", seconds));
+    CHECK(!TransactionJournal::parseDate("2022-04-31", seconds));
+    CHECK(TransactionJournal::parseDate("2022-04-30", seconds));
+    CHECK(!TransactionJournal::parseDate("2022-02-29", seconds));
+    CHECK(TransactionJournal::parseDate("2024-02-29", seconds));
+    CHECK(!TransactionJournal::parseDate("2024-02-30", seconds));
+    CHECK(!TransactionJournal::parseDate("1900-02-29", seconds));
+    CHECK(TransactionJournal::parseDate("2000-02-29", seconds));
+
+    //not dates at all
+    CHECK(!TransactionJournal::parseDate("2022-13-01", seconds));
+    CHECK(!TransactionJournal::parseDate("2022-00-10", seconds));
+    CHECK(!TransactionJournal::parseDate("2022-06-00", seconds));
+    CHECK(!TransactionJournal::parseDate("2022-6-1", seconds));
+    CHECK(!TransactionJournal::parseDate("2022/06/01", seconds));
+    CHECK(!TransactionJournal::parseDate("", seconds));
+}
+
+int main() {
+    testParseDate();
+    return TestCheck::report("TransactionJournalTest");
+}
@@ -0,0 +1,143 @@
+#include "../CollectibleStore.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+/*
+ * @file AllocBench.cpp
+ * @author Katarina McGaughy
+ * AllocBench counts how many times operator new is called while the
+ * store loads the files written by GenerateData and while it runs the
+ * commands. The counting operator new is only linked into this driver,
+ * the array, aligned and nothrow forms are counted by it as well.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -O2 -pthread bench/AllocBench.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o AllocBench
+ * ./GenerateData 1000000 1000 200000 && ./AllocBench
+ *
+ * Features:
+ * -allocations of the load
+ * -allocations of the load and the commands
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+static atomic<long> allocations(0);     // calls to operator new so far
+
+/**
+ * allocate
+ * this function counts an allocation and returns size bytes aligned
+ * to align, every operator new below calls it
+ * Preconditions: align must be a power of two
+ * Postconditions: returns the memory or nullptr if there is none
+ * @param size : bytes to allocate
+ * @param align : alignment of the memory
+ */
+static void* allocate(size_t size, size_t align) {
+    allocations++;
+    if (size == 0) {
+        size = 1;
+    }
+    if (align <= alignof(max_align_t)) {
+        return malloc(size);
+    }
+    //aligned_alloc needs a size that is a multiple of the alignment
+    return aligned_alloc(align, (size + align - 1) / align * align);
+}
+
+void* operator new(size_t size) {
+    void* p = allocate(size, alignof(max_align_t));
+    if (p == nullptr) {
+        throw bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, align_val_t align) {
+    void* p = allocate(size, static_cast<size_t>(align));
+    if (p == nullptr) {
+        throw bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](size_t size, align_val_t align) {
+    return operator new(size, align);
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    return allocate(size, alignof(max_align_t));
+}
+
+void* operator new[](size_t size, const nothrow_t&) noexcept {
+    return allocate(size, alignof(max_align_t));
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, align_val_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p, align_val_t) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t, align_val_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p, size_t, align_val_t) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, const nothrow_t&) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p, const nothrow_t&) noexcept {
+    free(p);
+}
+
+int main() {
+    //the store prints every item and transaction, only the counts are wanted
+    cout.setstate(ios::failbit);
+    long loaded = 0;
+    long replayed = 0;
+    {
+        //the store is not allocated here so only its own allocations count
+        CollectibleStore store;
+        InputSource inventoryFile("hw4inventory.txt");
+        store.initializeInventory(inventoryFile);
+        InputSource customerFile("hw4customers.txt");
+        store.initializeCustomers(customerFile);
+        loaded = allocations;
+        InputSource commandFile("hw4commands.txt");
+        store.getCommands(commandFile);
+        replayed = allocations;
+    }
+    cerr << "load: " << loaded << " allocations" << endl;
+    cerr << "load + replay: " << replayed << " allocations" << endl;
+    return 0;
+}
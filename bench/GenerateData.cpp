@@ -0,0 +1,101 @@
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+using namespace std;
+/*
+ * @file GenerateData.cpp
+ * @author Katarina McGaughy
+ * GenerateData writes the inventory, customer and command files the
+ * benchmarks load, in the same format as the store's own input files.
+ * The same arguments always give the same files.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -O2 bench/GenerateData.cpp -o GenerateData
+ * ./GenerateData 1000000 1000 200000
+ * writes hw4inventory.txt, hw4customers.txt and hw4commands.txt
+ *
+ * Features:
+ * -Coins, ComicBooks and SportsCards with repeated names
+ * -customers with unique IDs
+ * -pairs of S and B commands on items that exist
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+static const vector<string> coins = { "Lincoln Cent", "Liberty Nickel",
+    "Buffalo Nickel", "Mercury Dime", "Walking Liberty Half", "Morgan Dollar",
+    "Peace Dollar", "Indian Head Cent" };
+static const vector<string> grades = { "Mint", "Near Mint", "Excellent",
+    "Very Good", "Good", "Fair" };
+static const vector<string> titles = { "Superman", "X-Men", "Batman",
+    "Spider-Man", "Fantastic Four", "Wonder Woman", "Hulk", "Daredevil" };
+static const vector<string> publishers = { "DC", "Marvel", "Dark Horse", "Image" };
+static const vector<string> players = { "Mickey Mantle", "Ken Griffey Jr",
+    "Babe Ruth", "Hank Aaron", "Willie Mays", "Ted Williams", "Jackie Robinson" };
+static const vector<string> manufacturers = { "Topps", "Upper Deck", "Bowman",
+    "Fleer", "Donruss" };
+static const vector<string> firstNames = { "Donald", "Minnie", "Mickey",
+    "Daisy", "Goofy", "Pluto", "Scrooge", "Gyro" };
+static const vector<string> lastNames = { "Duck", "Mouse", "Dog", "McDuck",
+    "Gearloose", "Smith" };
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        cerr << "usage: GenerateData records customers commands" << endl;
+        return 1;
+    }
+    long records = atol(argv[1]);
+    long customers = atol(argv[2]);
+    long commands = atol(argv[3]);
+    mt19937 random(2022);
+    auto pick = [&random](const vector<string>& words) -> const string& {
+        return words[random() % words.size()];
+    };
+
+    //every item description is kept so the commands only use real items
+    vector<string> items;
+    items.reserve(records);
+    ofstream inventory("hw4inventory.txt");
+    for (long i = 0; i < records; i++) {
+        string year = to_string(1900 + random() % 120);
+        string count = to_string(1 + random() % 20);
+        string item;
+        switch (i % 3) {
+        case 0:
+            item = "M, " + year + ", " + to_string(1 + random() % 70) + ", " + pick(coins);
+            break;
+        case 1:
+            item = "C, " + year + ", " + pick(grades) + ", " + pick(titles) + ", " +
+                pick(publishers);
+            break;
+        default:
+            item = "S, " + year + ", " + pick(grades) + ", " + pick(players) + ", " +
+                pick(manufacturers);
+            break;
+        }
+        inventory << item.substr(0, 3) << count << ", " << item.substr(3) << "\n";
+        items.push_back(move(item));
+    }
+
+    ofstream customerFile("hw4customers.txt");
+    for (long i = 0; i < customers; i++) {
+        customerFile << 100000 + i << ", " << pick(firstNames) << " " << pick(lastNames) << "\n";
+    }
+
+    //a customer buys an item and then sells it back
+    ofstream commandFile("hw4commands.txt");
+    for (long i = 0; i + 1 < commands && !items.empty() && customers > 0; i += 2) {
+        long customer = 100000 + static_cast<long>(random() % customers);
+        const string& item = items[random() % items.size()];
+        commandFile << "S, " << customer << ", " << item << "\n";
+        commandFile << "B, " << customer << ", " << item << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "../CollectibleStore.h"
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+/*
+ * @file LoadBench.cpp
+ * @author Katarina McGaughy
+ * LoadBench times how long CollectibleStore takes to load an inventory
+ * file with one load thread and with more, so the speedup of the
+ * parallel load can be measured on the machine it runs on.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -O2 -pthread bench/LoadBench.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o LoadBench
+ * ./GenerateData 1000000 0 0 && ./LoadBench hw4inventory.txt 4
+ *
+ * Features:
+ * -load with 1, 2, ... up to the given number of threads
+ * -print the best of three loads in seconds for each and the speedup
+ *  over one thread
+ * -print the hardware threads of the machine, more load threads than
+ *  that can not show a speedup
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+int main(int argc, char** argv) {
+    string path = argc > 1 ? argv[1] : "hw4inventory.txt";
+    int maxThreads = argc > 2 ? atoi(argv[2]) : 4;
+    InputSource input(path);
+    if (!input.isOpen()) {
+        cerr << "could not open " << path << endl;
+        return 1;
+    }
+    //the store prints the whole inventory, only the times are wanted
+    cout.setstate(ios::failbit);
+    cerr << thread::hardware_concurrency() << " hardware threads" << endl;
+    double single = 0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double best = 0;
+        for (int run = 0; run < 3; run++) {
+            auto start = chrono::steady_clock::now();
+            {
+                CollectibleStore store;
+                store.setLoadThreads(threads);
+                store.initializeInventory(input);
+            }
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            best = run == 0 ? seconds : min(best, seconds);
+        }
+        if (threads == 1) {
+            single = best;
+        }
+        cerr << threads << " threads: " << best << " s, " << single / best
+            << " times one thread" << endl;
+    }
+    return 0;
+}
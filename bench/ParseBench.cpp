@@ -0,0 +1,54 @@
+#include "../InventoryFactory.h"
+#include "../InputSource.h"
+#include "../BulkLoader.h"
+#include <chrono>
+/*
+ * @file ParseBench.cpp
+ * @author Katarina McGaughy
+ * ParseBench times how fast InventoryFactory turns the records of an
+ * inventory file into Collectibles, one record at a time on one thread.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -O2 -pthread bench/ParseBench.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o ParseBench
+ * ./GenerateData 1000000 0 0 && ./ParseBench hw4inventory.txt
+ *
+ * Features:
+ * -parse every record with createCollectible
+ * -print the best of three runs in seconds and records per second
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+int main(int argc, char** argv) {
+    string path = argc > 1 ? argv[1] : "hw4inventory.txt";
+    InputSource input(path);
+    if (!input.isOpen()) {
+        cerr << "could not open " << path << endl;
+        return 1;
+    }
+    InventoryFactory factory;
+    double best = 0;
+    long records = 0;
+    for (int run = 0; run < 3; run++) {
+        records = 0;
+        auto start = chrono::steady_clock::now();
+        BulkLoader loader(input);
+        FieldTokenizer fields("");
+        while (loader.nextRecord(fields)) {
+            Collectible* item = factory.createCollectible(fields, false);
+            if (item != nullptr) {
+                records++;
+                delete item;
+            }
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        best = run == 0 ? seconds : min(best, seconds);
+    }
+    cout << records << " records in " << best << " s, ";
+    cout << static_cast<long>(records / best) << " records/s" << endl;
+    return 0;
+}
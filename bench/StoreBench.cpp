@@ -0,0 +1,54 @@
+#include "../CollectibleStore.h"
+#include <chrono>
+#include <cstring>
+#include <sys/resource.h>
+/*
+ * @file StoreBench.cpp
+ * @author Katarina McGaughy
+ * StoreBench times a whole run of the store on the files written by
+ * GenerateData and prints the time and the peak memory of the process.
+ * It runs once per call so the peak memory belongs to that run.
+ *
+ * Build and run from the source directory:
+ * g++ -std=c++17 -O2 -pthread bench/StoreBench.cpp $(ls *.cpp | grep -v -e '^Main.cpp' -e 'Test.cpp$' -e '^Collectible.cpp') -o StoreBench
+ * ./GenerateData 1000000 1000 200000
+ * ./StoreBench load
+ * ./StoreBench replay
+ *
+ * Features:
+ * -load only: inventory and customers
+ * -replay: load and then run every command
+ *
+ * Assumptions:
+ * -getrusage reports the peak memory in kilobytes (Linux)
+ *
+ * @version 0.1
+ * @date 2022-2-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+int main(int argc, char** argv) {
+    bool replay = argc > 1 && strcmp(argv[1], "replay") == 0;
+    //the store prints every item and transaction, only the totals are wanted
+    cout.setstate(ios::failbit);
+    auto start = chrono::steady_clock::now();
+    {
+        CollectibleStore store;
+        InputSource inventoryFile("hw4inventory.txt");
+        store.initializeInventory(inventoryFile);
+        InputSource customerFile("hw4customers.txt");
+        store.initializeCustomers(customerFile);
+        if (replay) {
+            InputSource commandFile("hw4commands.txt");
+            store.getCommands(commandFile);
+        }
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    cerr << (replay ? "load + replay: " : "load only: ") << seconds << " s, ";
+    cerr << usage.ru_maxrss / 1024 << " MB" << endl;
+    return 0;
+}